@@ -0,0 +1,169 @@
+/*
+* File: bench.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "orchestrator.hpp"
+
+namespace Bench {
+    using Clock = std::chrono::steady_clock;
+
+    // Registered benchmark case
+    struct Case {
+        const char* name;
+        void (*fn)();
+    };
+
+    inline std::vector<Case>& Registry() {
+        static std::vector<Case> cases;
+        return cases;
+    }
+
+    struct Registrar {
+        Registrar(const char* name, void (*fn)()) { Registry().push_back( { name, fn } ); }
+    };
+
+    // One measured case, kept so the whole run can be written out as JSON
+    struct Result {
+        std::string name;
+        size_t operations;
+        int repetitions;
+        double bestNs;      // fastest repetition
+        double medianNs;    // median repetition
+    };
+
+    inline std::vector<Result>& Results() {
+        static std::vector<Result> results;
+        return results;
+    }
+
+    // Keeps the optimizer from discarding benchmarked work
+    inline void Consume(uint64_t value) {
+        static volatile uint64_t sink = 0;
+        sink = sink + value;
+    }
+
+    /*
+     *  Function: Measure
+     *
+     *  Description:
+     *      Times run(state) over a number of repetitions, each with a freshly built state,
+     *      prints the fastest repetition and records it in Results(). Setup time is not measured.
+     *
+     *  In:
+     *      name        - label printed with the result
+     *      operations  - operations performed per run, used for ns/op
+     *      setup       - callable returning the state for one run
+     *      run         - callable taking the state by reference
+     *      repetitions - number of timed runs
+     *
+     *  Out:
+     *      none
+     */
+    template<class Setup, class Run>
+    void Measure(const std::string& name, size_t operations, Setup&& setup, Run&& run, int repetitions = 5) {
+        repetitions = std::max( 1, repetitions );
+
+        std::vector<double> samples;
+        samples.reserve( repetitions );
+        for(int r = 0; r < repetitions; ++r) {
+            auto state = setup();
+
+            const auto start = Clock::now();
+            run(state);
+            const auto stop = Clock::now();
+
+            samples.push_back( std::chrono::duration<double, std::nano>(stop - start).count() );
+        }
+
+        std::sort( samples.begin(), samples.end() );
+        const double best = samples.front();
+        Results().push_back( { name, operations, repetitions, best, samples[samples.size() / 2] } );
+
+        std::printf("%-56s %12.2f ns/op %12.3f ms\n", name.c_str(), best / static_cast<double>(operations), best / 1.0e6);
+    }
+
+    /*********************************
+    *
+    * Shared ECS fixtures:
+    *
+    *********************************/
+
+    // Fixed seed, so every suite and every run sees the same "random" order
+    template<class T>
+    std::vector<T> Shuffled(std::vector<T> values) {
+        std::shuffle( values.begin(), values.end(), std::mt19937{ 1234 } );
+        return values;
+    }
+
+    // Handles 0..count-1 plus a fixed shuffle of them, the shuffle stands in for random access
+    struct Handles {
+        explicit Handles(size_t count) : ordered(count) {
+            std::iota( ordered.begin(), ordered.end(), Entity{0} );
+            shuffled = Shuffled( ordered );
+        }
+
+        std::vector<Entity> ordered;
+        std::vector<Entity> shuffled;
+    };
+
+    struct Position { float x = 0.0f, y = 0.0f; };
+    struct Velocity { float x = 1.0f, y = 1.0f; };
+
+    // Does nothing, it only has to match entities so membership updates are part of the cost
+    class MotionSystem : public System {
+    public:
+        void Initialize(const SystemContext& ctx) override {}
+        void Update(float dt) override {}
+        void Shutdown() override {}
+    };
+
+    // Orchestrator with Position, Velocity and a MotionSystem over both
+    // Suites keep one for all their repetitions, so setup logging happens once
+    struct World {
+        explicit World(StorageBackend backend) {
+            orchestrator.Initialize( DEFAULT_MAX_ENTITIES, backend );
+            orchestrator.RegisterComponent<Position>();
+            orchestrator.RegisterComponent<Velocity>();
+
+            // Registered by hand rather than through CreateSystem to keep hold of its member list
+            motion = orchestrator.RegisterSystem<MotionSystem>();
+            Signature signature;
+            signature.set( orchestrator.GetComponentType<Position>() );
+            signature.set( orchestrator.GetComponentType<Velocity>() );
+            orchestrator.SetSystemSignature<MotionSystem>( signature );
+        }
+
+        Orchestrator orchestrator;
+        std::shared_ptr<MotionSystem> motion;
+        std::vector<Entity> live;
+    };
+}
+
+// Defines and registers a benchmark function
+#define TRAJAN_BENCHMARK(name) \
+    static void name(); \
+    static Bench::Registrar name##Registrar(#name, &name); \
+    static void name()
+
+#endif //BENCH_HPP
@@ -0,0 +1,101 @@
+/*
+* File: component_array_bench.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+#include "bench.hpp"
+#include "component_array.hpp"
+#include "transform_2d.hpp"
+
+namespace {
+    // Previous ComponentArray (two unordered_maps over a fixed array), kept for comparison
+    template<typename T, size_t Capacity>
+    class LegacyComponentArray {
+    public:
+        void InsertData(Entity entity, T component) {
+            size_t index = size;
+            entityToIndexMap[entity] = index;
+            indexToEntityMap[index] = entity;
+            (*componentArray)[index] = component;
+            size++;
+        }
+
+        void RemoveData(Entity entity) {
+            size_t indexRemoved = entityToIndexMap[entity];
+            size_t indexLast = size - 1;
+            (*componentArray)[indexRemoved] = (*componentArray)[indexLast];
+
+            Entity entityLast = indexToEntityMap[indexLast];
+            entityToIndexMap[entityLast] = indexRemoved;
+            indexToEntityMap[indexRemoved] = entityLast;
+
+            entityToIndexMap.erase(entity);
+            indexToEntityMap.erase(indexLast);
+
+            size--;
+        }
+
+        T* GetData(Entity entity) {
+            auto it = entityToIndexMap.find(entity);
+            if(it == entityToIndexMap.end()) return nullptr;
+            return &(*componentArray)[it->second];
+        }
+
+    private:
+        std::unique_ptr<std::array<T, Capacity>> componentArray = std::make_unique<std::array<T, Capacity>>();
+        std::unordered_map<Entity, size_t> entityToIndexMap;
+        std::unordered_map<size_t, Entity> indexToEntityMap;
+        size_t size = 0;
+    };
+
+    template<class Array>
+    void RunSuite(const std::string& label, size_t count) {
+        // Shuffled, as a system's membership set would hand them out after churn
+        const auto ids = Bench::Handles( count ).shuffled;
+        const std::string suffix = "/" + std::to_string(count);
+
+        auto empty = [] { return std::make_unique<Array>(); };
+        auto filled = [&] {
+            auto arr = std::make_unique<Array>();
+            for(Entity e : ids) arr->InsertData( e, Transform2D{} );
+            return arr;
+        };
+
+        Bench::Measure(label + "/Insert" + suffix, count, empty, [&](auto& arr) {
+            for(Entity e : ids) arr->InsertData( e, Transform2D{} );
+        });
+
+        Bench::Measure(label + "/GetRandom" + suffix, count, filled, [&](auto& arr) {
+            float sum = 0.f;
+            for(Entity e : ids) sum += arr->GetData( e )->rotation;
+            Bench::Consume( static_cast<uint64_t>(sum) );
+        });
+
+        Bench::Measure(label + "/Remove" + suffix, count, filled, [&](auto& arr) {
+            for(Entity e : ids) arr->RemoveData( e );
+        });
+    }
+}
+
+TRAJAN_BENCHMARK(ComponentArrayBench) {
+    constexpr size_t SMALL = 1'000;
+    constexpr size_t LARGE = 100'000;
+
+    RunSuite<LegacyComponentArray<Transform2D, SMALL>>("ComponentArray/Legacy", SMALL);
+    RunSuite<ComponentArray<Transform2D>>("ComponentArray/SparseSet", SMALL);
+
+    RunSuite<LegacyComponentArray<Transform2D, LARGE>>("ComponentArray/Legacy", LARGE);
+    RunSuite<ComponentArray<Transform2D>>("ComponentArray/SparseSet", LARGE);
+}
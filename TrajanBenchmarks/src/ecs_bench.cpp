@@ -0,0 +1,249 @@
+/*
+* File: ecs_bench.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "component_manager.hpp"
+#include "entity_manager.hpp"
+#include "orchestrator.hpp"
+#include "system_manager.hpp"
+
+// Regression suite for the ECS core: each manager on its own, then the Orchestrator on both backends.
+// Headless, nothing here needs a window or a GL context.
+
+namespace {
+    using Bench::Handles;
+    using Bench::MotionSystem;
+    using Bench::Position;
+    using Bench::Velocity;
+
+    class DrawSystem : public MotionSystem {};
+    class AISystem : public MotionSystem {};
+
+    void EntityManagerSuite(size_t count) {
+        const std::string suffix = "/" + std::to_string(count);
+        const Handles handles( count );
+
+        auto empty = [] { return std::make_unique<EntityManager>( DEFAULT_MAX_ENTITIES ); };
+        auto filled = [&] {
+            auto manager = std::make_unique<EntityManager>( DEFAULT_MAX_ENTITIES );
+            for(size_t i = 0; i < count; ++i) manager->CreateEntity();
+            return manager;
+        };
+        // Every slot freed once, so creation pops the free list instead of growing the tables
+        auto recycled = [&] {
+            auto manager = filled();
+            for(Entity e : handles.shuffled) manager->DestroyEntity( e );
+            return manager;
+        };
+
+        Bench::Measure("ECS/EntityManager/Create" + suffix, count, empty, [&](auto& m) {
+            for(size_t i = 0; i < count; ++i) m->CreateEntity();
+        });
+
+        Bench::Measure("ECS/EntityManager/CreateRecycled" + suffix, count, recycled, [&](auto& m) {
+            for(size_t i = 0; i < count; ++i) m->CreateEntity();
+        });
+
+        Bench::Measure("ECS/EntityManager/DestroyRandom" + suffix, count, filled, [&](auto& m) {
+            for(Entity e : handles.shuffled) m->DestroyEntity( e );
+        });
+    }
+
+    void ComponentManagerSuite(size_t count) {
+        const std::string suffix = "/" + std::to_string(count);
+        const Handles handles( count );
+
+        auto empty = [] {
+            auto manager = std::make_unique<ComponentManager>();
+            manager->RegisterComponent<Position>();
+            return manager;
+        };
+        auto filled = [&] {
+            auto manager = empty();
+            for(Entity e : handles.ordered) manager->AddComponent( e, Position{} );
+            return manager;
+        };
+
+        Bench::Measure("ECS/ComponentManager/Add" + suffix, count, empty, [&](auto& m) {
+            for(Entity e : handles.ordered) m->AddComponent( e, Position{} );
+        });
+
+        Bench::Measure("ECS/ComponentManager/RemoveRandom" + suffix, count, filled, [&](auto& m) {
+            for(Entity e : handles.shuffled) m->template RemoveComponent<Position>( e );
+        });
+
+        Bench::Measure("ECS/ComponentManager/GetRandom" + suffix, count, filled, [&](auto& m) {
+            float sum = 0.0f;
+            for(Entity e : handles.shuffled) sum += m->template GetComponent<Position>( e ).x;
+            Bench::Consume( static_cast<uint64_t>( sum ) );
+        });
+
+        Bench::Measure("ECS/ComponentManager/IterateDense" + suffix, count, filled, [&](auto& m) {
+            ComponentArray<Position>* array = m->template GetComponentArray<Position>();
+            Position* positions = array->Components();
+            float sum = 0.0f;
+            for(size_t i = 0; i < array->Size(); ++i) sum += positions[i].x;
+            Bench::Consume( static_cast<uint64_t>( sum ) );
+        });
+    }
+
+    // Three systems over two component types, so every signature change has candidates to test
+    struct SystemWorld {
+        SystemWorld() : manager( clock ) {
+            Signature position, velocity, both;
+            position.set( ComponentTypeId<Position>() );
+            velocity.set( ComponentTypeId<Velocity>() );
+            both = position | velocity;
+
+            manager.RegisterSystem<MotionSystem>();
+            manager.SetSignature<MotionSystem>( both );
+            manager.RegisterSystem<DrawSystem>();
+            manager.SetSignature<DrawSystem>( position );
+            manager.RegisterSystem<AISystem>();
+            manager.SetSignature<AISystem>( velocity );
+
+            full = both;
+        }
+
+        ChangeClock clock;
+        SystemManager manager;
+        Signature full;
+    };
+
+    void SystemManagerSuite(size_t count) {
+        const std::string suffix = "/" + std::to_string(count);
+        const Handles handles( count );
+
+        auto empty = [] { return std::make_unique<SystemWorld>(); };
+        auto filled = [&] {
+            auto world = empty();
+            for(Entity e : handles.ordered) world->manager.EntitySignatureChanged( e, {}, world->full );
+            return world;
+        };
+
+        Bench::Measure("ECS/SystemManager/SignatureJoin" + suffix, count, empty, [&](auto& w) {
+            for(Entity e : handles.ordered) w->manager.EntitySignatureChanged( e, {}, w->full );
+        });
+
+        Bench::Measure("ECS/SystemManager/SignatureLeaveRandom" + suffix, count, filled, [&](auto& w) {
+            for(Entity e : handles.shuffled) w->manager.EntitySignatureChanged( e, w->full, {} );
+        });
+
+        Bench::Measure("ECS/SystemManager/DestroyedRandom" + suffix, count, filled, [&](auto& w) {
+            for(Entity e : handles.shuffled) w->manager.EntityDestroyed( e, w->full );
+        });
+
+        Bench::Measure("ECS/SystemManager/EntitiesCreatedBatch" + suffix, count, empty, [&](auto& w) {
+            w->manager.EntitiesCreated( handles.ordered, w->full );
+        });
+    }
+
+    // Entity population a world is set up with before a measurement
+    enum class Population { Empty, Position, Moving };
+
+    // Shared world that respawns its population on demand
+    struct World : Bench::World {
+        using Bench::World::World;
+
+        // Respawns only when the population differs, or always for cases that consume it
+        World* Populate(Population wanted, size_t count, bool fresh) {
+            if( !fresh && wanted == population && ( live.size() == count || wanted == Population::Empty ) ) {
+                return this;
+            }
+
+            orchestrator.DestroyEntities( live );
+            live.clear();
+
+            if( wanted == Population::Position ) {
+                live = orchestrator.CreateEntities( count, Position{} );
+            }
+            else if( wanted == Population::Moving ) {
+                live = orchestrator.CreateEntities( count, Position{}, Velocity{} );
+            }
+            shuffled = Bench::Shuffled( live );
+            population = wanted;
+            return this;
+        }
+
+        std::vector<Entity> shuffled;
+        Population population = Population::Empty;
+    };
+
+    void OrchestratorSuite(const std::string& label, StorageBackend backend, size_t count) {
+        auto world = std::make_unique<World>( backend );
+        const std::string suffix = "/" + std::to_string(count);
+
+        auto setup = [&](Population population, bool fresh) {
+            return [&world, population, fresh, count] { return world->Populate( population, count, fresh ); };
+        };
+
+        Bench::Measure(label + "/CreateAdd" + suffix, count, setup(Population::Empty, true), [&](World* w) {
+            for(size_t i = 0; i < count; ++i) {
+                const Entity entity = w->orchestrator.CreateEntity();
+                w->orchestrator.AddComponent( entity, Position{} );
+                w->orchestrator.AddComponent( entity, Velocity{} );
+                w->live.push_back( entity );
+            }
+            w->population = Population::Moving;
+        });
+
+        Bench::Measure(label + "/DestroyRandom" + suffix, count, setup(Population::Moving, true), [&](World* w) {
+            for(Entity e : w->shuffled) w->orchestrator.DestroyEntity( e );
+            w->live.clear();
+            w->population = Population::Empty;
+        });
+
+        // Adding Velocity moves every entity into the system (and into another archetype)
+        Bench::Measure(label + "/AddComponent" + suffix, count, setup(Population::Position, true), [&](World* w) {
+            for(Entity e : w->live) w->orchestrator.AddComponent( e, Velocity{} );
+            w->population = Population::Moving;
+        });
+
+        Bench::Measure(label + "/RemoveComponentRandom" + suffix, count, setup(Population::Moving, true), [&](World* w) {
+            for(Entity e : w->shuffled) w->orchestrator.RemoveComponent<Velocity>( e );
+            w->population = Population::Position;
+        });
+
+        Bench::Measure(label + "/GetComponentRandom" + suffix, count, setup(Population::Moving, false), [&](World* w) {
+            float sum = 0.0f;
+            for(Entity e : w->shuffled) sum += w->orchestrator.GetComponent<Position>( e ).x;
+            Bench::Consume( static_cast<uint64_t>( sum ) );
+        });
+
+        Bench::Measure(label + "/ViewEach" + suffix, count, setup(Population::Moving, false), [&](World* w) {
+            w->orchestrator.View<Position, const Velocity>().Each([](Position& p, const Velocity& v) {
+                p.x += v.x;
+                p.y += v.y;
+            });
+        });
+
+        Bench::Measure(label + "/SystemIterate" + suffix, count, setup(Population::Moving, false), [&](World* w) {
+            uint64_t sum = 0;
+            for(Entity e : w->motion->entities) sum += e;
+            Bench::Consume( sum );
+        });
+    }
+}
+
+TRAJAN_BENCHMARK(EcsBench) {
+    for(size_t count : { size_t{1'000}, size_t{100'000}, size_t{1'000'000} }) {
+        EntityManagerSuite( count );
+        ComponentManagerSuite( count );
+        SystemManagerSuite( count );
+        OrchestratorSuite( "ECS/Orchestrator/SparseSet", StorageBackend::SparseSet, count );
+        OrchestratorSuite( "ECS/Orchestrator/Archetype", StorageBackend::Archetype, count );
+    }
+}
@@ -0,0 +1,84 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include "bench.hpp"
+
+namespace {
+    void WriteJsonString(std::FILE* file, const std::string& string) {
+        std::fputc('"', file);
+        for(char c : string) {
+            if( c == '"' || c == '\\' ) std::fputc('\\', file);
+            std::fputc(c, file);
+        }
+        std::fputc('"', file);
+    }
+
+    // One result per line so two runs can be diffed directly
+    bool WriteJson(const char* path) {
+        std::FILE* file = std::fopen( path, "w" );
+        if( !file ) {
+            std::fprintf(stderr, "Could not open %s for writing\n", path);
+            return false;
+        }
+
+#ifdef NDEBUG
+        const char* build = "release";
+#else
+        const char* build = "debug";
+#endif
+
+        std::fprintf(file, "{\n  \"build\": \"%s\",\n  \"hardware_threads\": %u,\n  \"results\": [\n",
+                     build, std::thread::hardware_concurrency());
+
+        const auto& results = Bench::Results();
+        for(size_t i = 0; i < results.size(); ++i) {
+            const Bench::Result& r = results[i];
+            std::fprintf(file, "    { \"name\": ");
+            WriteJsonString( file, r.name );
+            std::fprintf(file, ", \"operations\": %zu, \"repetitions\": %d, \"best_ns_per_op\": %.3f, \"median_ns_per_op\": %.3f, \"best_ms\": %.4f }%s\n",
+                         r.operations, r.repetitions,
+                         r.bestNs / static_cast<double>(r.operations), r.medianNs / static_cast<double>(r.operations),
+                         r.bestNs / 1.0e6, i + 1 < results.size() ? "," : "");
+        }
+
+        std::fprintf(file, "  ]\n}\n");
+        return std::fclose( file ) == 0;
+    }
+}
+
+// Usage: TrajanBenchmarks [filter] [--json results.json]
+int main(int argc, char** argv) {
+    // Optional filter: only run benchmarks whose name contains it
+    const char* filter = nullptr;
+    const char* jsonPath = nullptr;
+
+    for(int i = 1; i < argc; ++i) {
+        if( std::strcmp( argv[i], "--json" ) == 0 ) {
+            if( i + 1 >= argc ) {
+                std::fprintf(stderr, "--json needs an output path\n");
+                return 1;
+            }
+            jsonPath = argv[++i];
+        }
+        else {
+            filter = argv[i];
+        }
+    }
+
+    for(const auto& c : Bench::Registry()) {
+        if( filter && !std::strstr( c.name, filter ) ) {
+            continue;
+        }
+
+        std::printf("== %s ==\n", c.name);
+        c.fn();
+    }
+
+    if( jsonPath && !WriteJson( jsonPath ) ) {
+        return 1;
+    }
+
+    return 0;
+}
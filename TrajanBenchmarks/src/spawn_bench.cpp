@@ -0,0 +1,84 @@
+/*
+* File: spawn_bench.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench.hpp"
+#include "orchestrator.hpp"
+
+namespace {
+    using Bench::Position;
+    using Bench::Velocity;
+    using Bench::World;
+
+    // Per-entity calls, what spawning a wave looked like before the bulk API
+    struct PerEntity {
+        static void Spawn(World& world, size_t count) {
+            for(size_t i = 0; i < count; ++i) {
+                const Entity entity = world.orchestrator.CreateEntity();
+                world.orchestrator.AddComponent( entity, Position{} );
+                world.orchestrator.AddComponent( entity, Velocity{} );
+                world.live.push_back( entity );
+            }
+        }
+
+        static void Despawn(World& world) {
+            for(Entity entity : world.live) world.orchestrator.DestroyEntity( entity );
+            world.live.clear();
+        }
+    };
+
+    struct Bulk {
+        static void Spawn(World& world, size_t count) {
+            world.live = world.orchestrator.CreateEntities( count, Position{}, Velocity{} );
+        }
+
+        static void Despawn(World& world) {
+            world.orchestrator.DestroyEntities( world.live );
+            world.live.clear();
+        }
+    };
+
+    template<class Api>
+    void RunSuite(const std::string& label, StorageBackend backend, size_t count) {
+        auto world = std::make_unique<World>( backend );
+        const std::string suffix = "/" + std::to_string(count);
+
+        auto empty = [&] {
+            Bulk::Despawn( *world );
+            return world.get();
+        };
+        auto filled = [&] {
+            if( world->live.empty() ) Bulk::Spawn( *world, count );
+            return world.get();
+        };
+
+        Bench::Measure(label + "/SpawnBurst" + suffix, count, empty, [&](World* w) {
+            Api::Spawn( *w, count );
+        });
+
+        Bench::Measure(label + "/DespawnBurst" + suffix, count, filled, [&](World* w) {
+            Api::Despawn( *w );
+        });
+    }
+}
+
+TRAJAN_BENCHMARK(SpawnBench) {
+    for(size_t count : { size_t{10'000}, size_t{100'000} }) {
+        RunSuite<PerEntity>("Spawn/SparseSet/PerEntity", StorageBackend::SparseSet, count);
+        RunSuite<Bulk>("Spawn/SparseSet/Bulk", StorageBackend::SparseSet, count);
+        RunSuite<PerEntity>("Spawn/Archetype/PerEntity", StorageBackend::Archetype, count);
+        RunSuite<Bulk>("Spawn/Archetype/Bulk", StorageBackend::Archetype, count);
+    }
+}
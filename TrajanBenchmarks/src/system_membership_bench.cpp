@@ -0,0 +1,69 @@
+/*
+* File: system_membership_bench.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include <memory>
+#include <set>
+
+#include "bench.hpp"
+#include "sparse_set.hpp"
+
+namespace {
+    // Previous System::entities membership (red-black tree), kept for comparison
+    struct LegacyMembership {
+        void Insert(Entity entity) { entities.insert( entity ); }
+        void Remove(Entity entity) { entities.erase( entity ); }
+        std::set<Entity> entities;
+    };
+
+    struct DenseMembership {
+        void Insert(Entity entity) { if( !entities.Contains( entity ) ) entities.Insert( entity ); }
+        void Remove(Entity entity) { if( entities.Contains( entity ) ) entities.Remove( entity ); }
+        SparseSet entities;
+    };
+
+    template<class Membership>
+    void RunSuite(const std::string& label, size_t count) {
+        const Bench::Handles handles( count );
+        const std::string suffix = "/" + std::to_string(count);
+
+        auto empty = [] { return std::make_unique<Membership>(); };
+        auto filled = [&] {
+            auto m = std::make_unique<Membership>();
+            for(Entity e : handles.ordered) m->Insert( e );
+            return m;
+        };
+
+        // Burst of freshly spawned entities joining the system
+        Bench::Measure(label + "/SpawnBurst" + suffix, count, empty, [&](auto& m) {
+            for(Entity e : handles.ordered) m->Insert( e );
+        });
+
+        // What a system does every frame
+        Bench::Measure(label + "/IterateFrame" + suffix, count, filled, [&](auto& m) {
+            uint64_t sum = 0;
+            for(Entity e : m->entities) sum += e;
+            Bench::Consume( sum );
+        });
+
+        // Entities leaving in arbitrary order
+        Bench::Measure(label + "/DespawnRandom" + suffix, count, filled, [&](auto& m) {
+            for(Entity e : handles.shuffled) m->Remove( e );
+        });
+    }
+}
+
+TRAJAN_BENCHMARK(SystemMembershipBench) {
+    for(size_t count : { size_t{1'000}, size_t{100'000} }) {
+        RunSuite<LegacyMembership>("SystemMembership/StdSet", count);
+        RunSuite<DenseMembership>("SystemMembership/SparseSet", count);
+    }
+}
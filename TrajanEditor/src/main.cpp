@@ -1,16 +1,17 @@
-#include <chrono>
 #include <iostream>
 #include <ostream>
 
 #include <trajan_engine.hpp>
 #include <imgui.h>
 #include <uuid.hpp>
+#include <hierarchy.hpp>
 #include <sprite.hpp>
 #include <transform_2d.hpp>
 #include <orchestrator.hpp>
 #include <engine.hpp>
 #include <asset_system.hpp>
 #include <i_renderer.hpp>
+#include <trace.hpp>
 
 #include "mesh_manager.hpp"
 #include "shader.hpp"
@@ -122,16 +123,27 @@ int main(void) {
 
     ecs->AddComponent(joe, s);
 
+    // Child entity, orbits with joe's rotation (local units are joe's scaled units)
+    Entity child = ecs->CreateEntity();
+
+    ecs->AddComponent(child, Transform2D({
+        .position = Vector2(1.5f, 0.0f),
+        .rotation = 0.0f,
+        .scale = Vector2(0.5f, 0.5f),
+    }));
+    ecs->AddComponent(child, Hierarchy{ joe });
+    ecs->AddComponent(child, s);
+
     // UUID test
     UUID id = UUID::generate();
     Log::Message(id.toString());
 
     float angle = 0.0f;
 
-    float dt = 0.0f;
-    while(!engine->ShouldShutdown()) {
-        auto start = std::chrono::high_resolution_clock::now();
+    // Simulate at 60 Hz whatever the display rate, rendering interpolates between steps
+    engine->SetFixedTimestep(1.0f / 60.0f);
 
+    while(!engine->ShouldShutdown()) {
         FrameData fd;
         fd.view = Matrix4(1.0f);
         fd.proj = glm::ortho(0.0f, 800.0f, 600.0f, 0.0f, -1.0f, 1.0f);
@@ -139,26 +151,56 @@ int main(void) {
         renderer->SetFrameData(fd); // Frame data can be set at any time
 
         // Rotating Entity
-        angle += dt;
+        angle += engine->GetFrameTime();
         auto& t = ecs->GetComponent<Transform2D>(joe);
         t.rotation = angle;
 
         // MUST begin frame before sending any render commands or drawing GUI
         engine->BeginFrame();
 
-        engine->Update(dt);
+        // Measures the frame itself and runs as many simulation steps as have accumulated
+        engine->Update();
 
         // Test: imgui
         ImGui::Begin("Test");
         ImGui::Text("Hello World!");
         ImGui::End();
 
-        // Must end frame after any GUI or application draws
-        engine->EndFrame();
+        // Per-system timing, only filled in builds with TRAJAN_PROFILE_SYSTEMS
+        if constexpr (SYSTEM_PROFILING_ENABLED) {
+            ImGui::Begin("Systems");
+            for(const SystemTimings& timings : ecs->GetSystemTimings()) {
+                ImGui::Text("%s: %.3f / %.3f / %.3f ms (min/avg/p99), %u entities",
+                            timings.name.c_str(), timings.minMs, timings.avgMs, timings.p99Ms, timings.entities);
+            }
+            ImGui::End();
+        }
+
+        const FrameReport frame = engine->GetFrameReport();
+        ImGui::Begin("Frame");
+        ImGui::Text("%.2f / %.2f / %.2f ms (p50/p95/p99), max %.2f ms", frame.p50Ms, frame.p95Ms, frame.p99Ms, frame.maxMs);
+        ImGui::Text("%u hitches in the last %u frames, %llu total", frame.hitches, frame.frames,
+                    static_cast<unsigned long long>( frame.totalHitches ));
+        for(size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+            ImGui::Text("%s: %.3f ms", FramePhaseName( static_cast<FramePhase>( phase ) ), frame.phaseAvgMs[phase]);
+        }
+        ImGui::End();
 
-        auto stop = std::chrono::high_resolution_clock::now();
+#ifdef TRAJAN_TRACE
+        // Open the capture in ui.perfetto.dev or chrome://tracing
+        ImGui::Begin("Trace");
+        if( !Trace::IsRecording() ) {
+            if( ImGui::Button("Start Capture") ) Trace::Start();
+        }
+        else if( ImGui::Button("Stop Capture") ) {
+            Trace::Stop();
+            Trace::WriteChromeJson("trajan_trace.json");
+        }
+        ImGui::End();
+#endif
 
-        dt = std::chrono::duration_cast<std::chrono::duration<float>>(stop - start).count();
+        // Must end frame after any GUI or application draws
+        engine->EndFrame();
     }
 
     engine->Shutdown();
@@ -0,0 +1,23 @@
+/*
+* File: hierarchy.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef HIERARCHY_HPP
+#define HIERARCHY_HPP
+#include "entity.hpp"
+
+// Attaches an entity's Transform2D to its parent's world transform
+// The parent needs a Transform2D and WorldTransform of its own, otherwise the entity is treated as a root.
+struct Hierarchy {
+    Entity parent = NULL_ENTITY;
+};
+
+#endif //HIERARCHY_HPP
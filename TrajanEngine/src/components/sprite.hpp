@@ -16,6 +16,7 @@
 //#include "mesh.hpp"
 //#include "shader.hpp"
 #include "asset_handle.hpp"
+#include "snapshot.hpp"
 
 class Mesh;
 class Shader;
@@ -25,4 +26,11 @@ struct Sprite {
     AssetHandle<Shader> shader;
 };
 
+// Snapshots store the asset UUIDs, handles are re-acquired from the asset managers on load
+template<>
+struct ComponentSerializer<Sprite> {
+    TRAJANENGINE_API static void Write(SnapshotWriter& out, const Sprite& sprite);
+    TRAJANENGINE_API static void Read(SnapshotReader& in, Sprite& sprite);
+};
+
 #endif //SPRITE_HPP
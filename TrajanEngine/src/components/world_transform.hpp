@@ -0,0 +1,22 @@
+/*
+* File: world_transform.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef WORLD_TRANSFORM_HPP
+#define WORLD_TRANSFORM_HPP
+#include "math.hpp"
+
+// Model matrix of an entity, Transform2D composed with every parent's, written by TransformSystem
+struct WorldTransform {
+    Matrix4 matrix{ 1.0f };
+};
+
+#endif //WORLD_TRANSFORM_HPP
@@ -0,0 +1,232 @@
+/*
+* File: archetype.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef ARCHETYPE_HPP
+#define ARCHETYPE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "change_tick.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+
+// Fixed-size block of memory holding up to ChunkCapacity() rows of one archetype
+// Layout is SoA: [Entity x capacity][column 0 x capacity][column 1 x capacity]...[ticks 0 x capacity][ticks 1 x capacity]...
+struct ArchetypeChunk {
+    // Frees with the alignment the chunk was allocated with
+    struct Deleter {
+        std::align_val_t alignment;
+
+        void operator()(std::byte* ptr) const;
+    };
+
+    std::unique_ptr<std::byte[], Deleter> memory;
+    uint32_t count = 0;
+};
+
+// Set of entities sharing the exact same Signature, stored in chunks
+class Archetype {
+public:
+    // Target chunk size, archetypes whose row is bigger than this get one row per chunk
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+
+    // Every column starts on its own cache line
+    static constexpr size_t CHUNK_ALIGNMENT = 64;
+
+    // Position of a row inside the archetype
+    struct Row {
+        uint32_t chunk = 0;
+        uint32_t row = 0;
+    };
+
+    Archetype(const Signature& signature, const std::array<ComponentInfo, MAX_COMPONENTS>& registry)
+        : signature(signature)
+    {
+        columnOf.fill( -1 );
+        signature.ForEach([&](size_t type) {
+            // Tags live in the signature only
+            if( registry[type].tag ) return;
+
+            columnOf[type] = static_cast<int16_t>( types.size() );
+            types.push_back( static_cast<ComponentType>( type ) );
+            infos.push_back( registry[type] );
+            chunkAlignment = std::max( chunkAlignment, registry[type].align );
+        });
+
+        // Fit as many rows as possible into CHUNK_BYTES
+        size_t rowBytes = sizeof(Entity);
+        for(const auto& info : infos) rowBytes += info.size + sizeof(ComponentTicks);
+
+        chunkCapacity = static_cast<uint32_t>( std::max<size_t>( 1, CHUNK_BYTES / rowBytes ) );
+        while( chunkCapacity > 1 && Layout( chunkCapacity ) > CHUNK_BYTES ) {
+            --chunkCapacity;
+        }
+        chunkBytes = Layout( chunkCapacity );
+    }
+
+    ~Archetype() {
+        for(uint32_t c = 0; c < chunks.size(); ++c) {
+            for(uint32_t r = 0; r < chunks[c].count; ++r) {
+                DestroyRow( { c, r } );
+            }
+        }
+    }
+
+    Archetype(const Archetype&) = delete;
+    Archetype& operator=(const Archetype&) = delete;
+
+    [[nodiscard]] const Signature& GetSignature() const { return signature; }
+
+    // Component types that have a column (tags excluded)
+    [[nodiscard]] const std::vector<ComponentType>& Types() const { return types; }
+
+    // True if entities here own the type, tag or not
+    [[nodiscard]] bool Has(ComponentType type) const { return signature.test( type ); }
+
+    // Column index of a component type, -1 if the archetype has no column for it
+    [[nodiscard]] int Column(ComponentType type) const { return columnOf[type]; }
+
+    [[nodiscard]] size_t Size() const { return entityCount; }
+    [[nodiscard]] uint32_t ChunkCapacity() const { return chunkCapacity; }
+    [[nodiscard]] size_t ChunkCount() const { return chunks.size(); }
+    [[nodiscard]] ArchetypeChunk& GetChunk(size_t index) { return chunks[index]; }
+
+    [[nodiscard]] Entity* Entities(ArchetypeChunk& chunk) const {
+        return reinterpret_cast<Entity*>( chunk.memory.get() );
+    }
+
+    // Start of a component column inside a chunk
+    template<typename T>
+    [[nodiscard]] T* Components(ArchetypeChunk& chunk, ComponentType type) const {
+        return reinterpret_cast<T*>( chunk.memory.get() + columnOffsets[columnOf[type]] );
+    }
+
+    [[nodiscard]] void* Element(Row at, int column) {
+        return chunks[at.chunk].memory.get() + columnOffsets[column] + at.row * infos[column].size;
+    }
+
+    // Start of a column's change ticks inside a chunk
+    [[nodiscard]] ComponentTicks* Ticks(ArchetypeChunk& chunk, int column) const {
+        return reinterpret_cast<ComponentTicks*>( chunk.memory.get() + tickOffsets[column] );
+    }
+
+    [[nodiscard]] ComponentTicks& TicksAt(Row at, int column) {
+        return Ticks( chunks[at.chunk], column )[at.row];
+    }
+
+    // Appends a row for entity, its components are left uninitialized for the caller to construct
+    Row PushRow(Entity entity) {
+        if( chunks.empty() || chunks.back().count == chunkCapacity ) {
+            ArchetypeChunk chunk;
+            const std::align_val_t alignment{ chunkAlignment };
+            chunk.memory = { static_cast<std::byte*>( ::operator new( chunkBytes, alignment ) ), ArchetypeChunk::Deleter{ alignment } };
+            chunks.push_back( std::move(chunk) );
+        }
+
+        const Row at{ static_cast<uint32_t>( chunks.size() - 1 ), chunks.back().count };
+        Entities( chunks.back() )[at.row] = entity;
+        ++chunks.back().count;
+        ++entityCount;
+        return at;
+    }
+
+    // Destroys every component in a row, the row itself stays until FillHole
+    void DestroyRow(Row at) {
+        for(size_t c = 0; c < infos.size(); ++c) {
+            infos[c].destroy( Element( at, static_cast<int>(c) ) );
+        }
+    }
+
+    // Moves the last row into a row whose components were already destroyed or moved out <- Goal is to maintain density
+    // Returns the entity that now occupies the row, or NULL_ENTITY if the removed row was the last one
+    Entity FillHole(Row at) {
+        ArchetypeChunk& lastChunk = chunks.back();
+        const Row last{ static_cast<uint32_t>( chunks.size() - 1 ), lastChunk.count - 1 };
+
+        Entity moved = NULL_ENTITY;
+        if( at.chunk != last.chunk || at.row != last.row ) {
+            for(size_t c = 0; c < infos.size(); ++c) {
+                infos[c].moveConstruct( Element( at, static_cast<int>(c) ), Element( last, static_cast<int>(c) ) );
+                TicksAt( at, static_cast<int>(c) ) = TicksAt( last, static_cast<int>(c) );
+            }
+            moved = Entities( lastChunk )[last.row];
+            Entities( chunks[at.chunk] )[at.row] = moved;
+        }
+
+        --lastChunk.count;
+        --entityCount;
+        if( lastChunk.count == 0 ) {
+            chunks.pop_back();
+        }
+        return moved;
+    }
+
+    // Cached neighbours: archetype reached by adding/removing one component type
+    std::unordered_map<ComponentType, Archetype*> addEdges;
+    std::unordered_map<ComponentType, Archetype*> removeEdges;
+
+private:
+    // Computes column offsets for a given capacity, returns total bytes needed
+    size_t Layout(uint32_t capacity) {
+        columnOffsets.resize( infos.size() );
+        tickOffsets.resize( infos.size() );
+
+        size_t offset = sizeof(Entity) * capacity;
+        for(size_t c = 0; c < infos.size(); ++c) {
+            const size_t align = std::max( infos[c].align, CHUNK_ALIGNMENT );
+            offset = ( offset + align - 1 ) / align * align;
+            columnOffsets[c] = offset;
+            offset += infos[c].size * capacity;
+        }
+
+        // Ticks after the data, so component streams stay contiguous
+        for(size_t c = 0; c < infos.size(); ++c) {
+            offset = ( offset + CHUNK_ALIGNMENT - 1 ) / CHUNK_ALIGNMENT * CHUNK_ALIGNMENT;
+            tickOffsets[c] = offset;
+            offset += sizeof(ComponentTicks) * capacity;
+        }
+        return offset;
+    }
+
+    Signature signature;
+
+    // Component type -> column index (-1 = not present)
+    std::array<int16_t, MAX_COMPONENTS> columnOf{};
+
+    // Per column data, ordered by component type
+    std::vector<ComponentType> types;
+    std::vector<ComponentInfo> infos;
+    std::vector<size_t> columnOffsets;
+    std::vector<size_t> tickOffsets;
+
+    uint32_t chunkCapacity = 1;
+    size_t chunkBytes = 0;
+
+    // Chunk base alignment, column offsets are only aligned relative to it
+    size_t chunkAlignment = CHUNK_ALIGNMENT;
+    size_t entityCount = 0;
+
+    std::vector<ArchetypeChunk> chunks;
+};
+
+inline void ArchetypeChunk::Deleter::operator()(std::byte* ptr) const {
+    ::operator delete( ptr, alignment );
+}
+
+#endif //ARCHETYPE_HPP
@@ -0,0 +1,296 @@
+/*
+* File: archetype_manager.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef ARCHETYPE_MANAGER_HPP
+#define ARCHETYPE_MANAGER_HPP
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include "archetype.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "log.hpp"
+
+// Archetype storage backend: entities with identical signatures share SoA chunks
+class ArchetypeManager {
+public:
+    template<typename T>
+    void RegisterComponent(ComponentType type) {
+        infos[type] = MakeComponentInfo<T>();
+    }
+
+    template<typename T>
+    void AddComponent(Entity entity, ComponentType type, T component, Tick tick = 0) {
+        // Moved components are in place, construct the new one in its column
+        void* slot = Emplace( entity, type, tick );
+        if constexpr ( !IsTagComponent<T> ) {
+            if( slot ) new ( slot ) T( std::move(component) );
+        }
+    }
+
+    // Type-erased add: relocates the component out of src, src is only consumed when true is returned
+    bool AddComponentRelocated(Entity entity, ComponentType type, void* src, Tick tick) {
+        void* slot = Emplace( entity, type, tick );
+        if( !slot ) return false;
+
+        if( infos[type].tag ) {
+            infos[type].destroy( src );
+        }
+        else {
+            infos[type].moveConstruct( slot, src );
+        }
+        return true;
+    }
+
+    /*
+     *  Function: AddComponents
+     *
+     *  Description:
+     *      Places a batch of component-less entities straight into the archetype for signature,
+     *      skipping the intermediate archetypes one-at-a-time adds would walk through.
+     *
+     *  In:
+     *      batch      - new entities with no components yet
+     *      signature  - union of types
+     *      types      - component type of each of components...
+     *      tick       - add tick stamped on every component
+     *      components - values copied into every entity's row
+     *
+     *  Out:
+     *      none
+     */
+    template<typename... Ts>
+    void AddComponents(std::span<const Entity> batch, const Signature& signature,
+                       const std::array<ComponentType, sizeof...(Ts)>& types, Tick tick, const Ts&... components) {
+        Archetype* target = GetOrCreate( signature );
+        if( !target || batch.empty() ) return;
+
+        Assure( *std::max_element( batch.begin(), batch.end(), [](Entity a, Entity b) { return EntityIndex( a ) < EntityIndex( b ); } ) );
+
+        for(Entity entity : batch) {
+            Location& location = locations[EntityIndex( entity )];
+            location.archetype = target;
+            location.at = target->PushRow( entity );
+
+            size_t i = 0;
+            ( Construct<Ts>( target, location.at, types[i++], tick, components ), ... );
+        }
+    }
+
+    void RemoveComponent(Entity entity, ComponentType type, const char* typeName) {
+        Location* location = Find( entity );
+        if( !location || !location->archetype->Has( type ) ) {
+            Log::Warn("Tried to remove " + std::string(typeName) + " from non-owning entity of ID " + std::to_string(entity) );
+            return;
+        }
+
+        Archetype* source = location->archetype;
+        if( !infos[type].tag ) {
+            infos[type].destroy( source->Element( location->at, source->Column( type ) ) );
+        }
+
+        // nullptr target = entity has no components left and leaves archetype storage
+        MoveEntity( entity, *location, Neighbour( source, type, false ), type );
+    }
+
+    template<typename T>
+    T* GetComponent(Entity entity, ComponentType type) {
+        Location* location = Find( entity );
+        if( !location || !location->archetype->Has( type ) ) {
+            Log::Error("Entity " + std::to_string(entity) + " does not have component " + std::string(typeid(T).name()) );
+            return nullptr;
+        }
+
+        if constexpr ( IsTagComponent<T> ) {
+            return &TagInstance<T>();
+        }
+        return static_cast<T*>( location->archetype->Element( location->at, location->archetype->Column( type ) ) );
+    }
+
+    // Change ticks of an owned component, nullptr if the entity does not own one
+    ComponentTicks* GetTicks(Entity entity, ComponentType type) {
+        Location* location = Find( entity );
+        if( !location || location->archetype->Column( type ) < 0 ) return nullptr;
+
+        return &location->archetype->TicksAt( location->at, location->archetype->Column( type ) );
+    }
+
+    [[nodiscard]] bool HasComponent(Entity entity, ComponentType type) {
+        Location* location = Find( entity );
+        return location && location->archetype->Has( type );
+    }
+
+    void EntityDestroyed(Entity entity) {
+        Location* location = Find( entity );
+        if( !location ) return;
+
+        location->archetype->DestroyRow( location->at );
+        Release( *location );
+    }
+
+    // Calls fn(Archetype&, ArchetypeChunk&) for every non-empty chunk whose signature contains required
+    template<typename Fn>
+    void ForEachChunk(const Signature& required, Fn&& fn) {
+        for(auto& archetype : archetypes) {
+            if( archetype->Size() == 0 || !archetype->GetSignature().Contains( required ) ) continue;
+
+            for(size_t c = 0; c < archetype->ChunkCount(); ++c) {
+                fn( *archetype, archetype->GetChunk( c ) );
+            }
+        }
+    }
+
+    [[nodiscard]] const std::vector<std::unique_ptr<Archetype>>& Archetypes() const { return archetypes; }
+
+private:
+    // Moves entity into the archetype that adds type, returns the uninitialized slot for the new component
+    // Tags have no slot, they get a non-null placeholder that must not be written to
+    void* Emplace(Entity entity, ComponentType type, Tick tick) {
+        Location& location = Assure( entity );
+        Archetype* source = location.archetype;
+
+        if( source && source->Has( type ) ) {
+            Log::Error("Attempted redundant add of component " + std::string(infos[type].name) + " to entity of ID: " + std::to_string(entity) );
+            return nullptr;
+        }
+
+        Archetype* target = Neighbour( source, type, true );
+        MoveEntity( entity, location, target );
+
+        if( infos[type].tag ) {
+            static std::byte placeholder;
+            return &placeholder;
+        }
+
+        target->TicksAt( location.at, target->Column( type ) ) = { tick, tick };
+        return target->Element( location.at, target->Column( type ) );
+    }
+
+    // Bulk add helper, constructs one component of a new row
+    template<typename T>
+    static void Construct(Archetype* target, Archetype::Row at, ComponentType type, Tick tick, const T& component) {
+        if constexpr ( !IsTagComponent<T> ) {
+            new ( target->Element( at, target->Column( type ) ) ) T( component );
+            target->TicksAt( at, target->Column( type ) ) = { tick, tick };
+        }
+    }
+
+    // Where an entity's row lives (archetype == nullptr = no components)
+    struct Location {
+        Archetype* archetype = nullptr;
+        Archetype::Row at{};
+    };
+
+    Location& Assure(Entity entity) {
+        const uint32_t index = EntityIndex( entity );
+        if( index >= locations.size() ) {
+            locations.resize( index + 1 );
+        }
+        return locations[index];
+    }
+
+    // Location of a living row for exactly this handle, nullptr otherwise
+    Location* Find(Entity entity) {
+        const uint32_t index = EntityIndex( entity );
+        if( index >= locations.size() || !locations[index].archetype ) return nullptr;
+
+        Location& location = locations[index];
+        ArchetypeChunk& chunk = location.archetype->GetChunk( location.at.chunk );
+        return location.archetype->Entities( chunk )[location.at.row] == entity ? &location : nullptr;
+    }
+
+    Archetype* GetOrCreate(const Signature& signature) {
+        if( signature.none() ) return nullptr;
+
+        auto it = archetypeIndex.find( signature );
+        if( it != archetypeIndex.end() ) return it->second;
+
+        archetypes.push_back( std::make_unique<Archetype>( signature, infos ) );
+        archetypeIndex.emplace( signature, archetypes.back().get() );
+        return archetypes.back().get();
+    }
+
+    // Archetype reached from source by adding or removing one type, cached on the source's edges
+    Archetype* Neighbour(Archetype* source, ComponentType type, bool add) {
+        if( !source ) {
+            Signature signature;
+            signature.set( type );
+            return GetOrCreate( signature );
+        }
+
+        auto& edges = add ? source->addEdges : source->removeEdges;
+        auto it = edges.find( type );
+        if( it != edges.end() ) return it->second;
+
+        Signature signature = source->GetSignature();
+        signature.set( type, add );
+        Archetype* target = GetOrCreate( signature );
+        edges.emplace( type, target );
+        return target;
+    }
+
+    // Moves an entity's row into target, skipping a column that was already destroyed
+    void MoveEntity(Entity entity, Location& location, Archetype* target, int skipType = -1) {
+        Archetype* source = location.archetype;
+
+        Archetype::Row to{};
+        if( target ) {
+            to = target->PushRow( entity );
+        }
+
+        if( source ) {
+            for(ComponentType type : source->Types()) {
+                if( type == skipType ) continue;
+
+                void* from = source->Element( location.at, source->Column( type ) );
+                if( target && target->Column( type ) >= 0 ) {
+                    infos[type].moveConstruct( target->Element( to, target->Column( type ) ), from );
+                    target->TicksAt( to, target->Column( type ) ) = source->TicksAt( location.at, source->Column( type ) );
+                }
+                else {
+                    infos[type].destroy( from );
+                }
+            }
+            Release( location );
+        }
+
+        location.archetype = target;
+        location.at = to;
+    }
+
+    // Closes the hole left by a row whose components are gone and patches the entity moved into it
+    void Release(Location& location) {
+        const Entity moved = location.archetype->FillHole( location.at );
+        if( moved != NULL_ENTITY ) {
+            locations[EntityIndex( moved )].at = location.at;
+        }
+        location.archetype = nullptr;
+        location.at = {};
+    }
+
+    // Registered component operations <- Index corresponds to component type
+    std::array<ComponentInfo, MAX_COMPONENTS> infos{};
+
+    // Entity index -> row location
+    std::vector<Location> locations;
+
+    // All archetypes, plus lookup by signature
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<Signature, Archetype*, Signature::Hasher> archetypeIndex;
+};
+
+#endif //ARCHETYPE_MANAGER_HPP
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "i_asset_manager.hpp"
+#include "trace.hpp"
 
 class AssetSystem {
 public:
@@ -40,7 +41,17 @@ public:
         throw std::runtime_error("Get() failed");
     }
 
+    // Manager serving asset type AssetT, nullptr if none was emplaced (used to resolve UUIDs)
+    template<class AssetT>
+    IAssetManagerT<AssetT>* GetFor() {
+        for(auto& m : m_managers) {
+            if(auto p = dynamic_cast<IAssetManagerT<AssetT>*>(m.get())) return p;
+        }
+        return nullptr;
+    }
+
     void CollectGarbage() {
+        TRAJAN_TRACE_ZONE( "AssetSystem::CollectGarbage" );
         for (auto& mgr : m_managers) mgr->CollectGarbage();
     }
 
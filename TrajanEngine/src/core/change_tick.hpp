@@ -0,0 +1,53 @@
+/*
+* File: change_tick.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef CHANGE_TICK_HPP
+#define CHANGE_TICK_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// Monotonic counter used to tell which components changed since a system last ran
+using Tick = uint32_t;
+
+// Ticks stored next to every component
+struct ComponentTicks {
+    Tick added = 0;
+    Tick changed = 0;
+};
+
+// True if tick happened after since, stays correct across wraparound as long as ticks are less than 2^31 apart
+inline bool IsNewer(Tick tick, Tick since) {
+    return static_cast<int32_t>( tick - since ) > 0;
+}
+
+// World change clock, advanced once per system run and once at the end of every update
+// Writes are stamped with Now(), a system sees every stamp newer than the tick its previous run started on.
+class ChangeClock {
+public:
+    [[nodiscard]] Tick Now() const { return tick.load( std::memory_order_acquire ); }
+
+    // Returns the new tick
+    Tick Advance() { return tick.fetch_add( 1, std::memory_order_acq_rel ) + 1; }
+
+    // Last-run tick of the system running on the calling thread, 0 (everything is new) outside systems
+    static Tick& ThreadSince() {
+        static thread_local Tick since = 0;
+        return since;
+    }
+
+private:
+    // Starts at 1 so a system that never ran (last run 0) sees every component as new
+    std::atomic<Tick> tick{ 1 };
+};
+
+#endif //CHANGE_TICK_HPP
@@ -0,0 +1,184 @@
+/*
+* File: command_buffer.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef COMMAND_BUFFER_HPP
+#define COMMAND_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "component.hpp"
+#include "entity.hpp"
+
+// Deferred structural changes (create/destroy/add/remove) recorded while systems run
+// Played back in recording order by Orchestrator::FlushCommands, recording is thread safe.
+class CommandBuffer {
+public:
+    // Payload arena block size, bigger components get a block of their own
+    static constexpr size_t BLOCK_BYTES = 16 * 1024;
+
+    // Command::pending value for commands that target an existing entity
+    static constexpr uint32_t NO_PENDING = UINT32_MAX;
+
+    // Entity that will only exist once the buffer is played back
+    struct PendingEntity {
+        uint32_t index = NO_PENDING;
+    };
+
+    enum class Op : uint8_t {
+        Create,
+        Destroy,
+        Add,
+        Remove
+    };
+
+    struct Command {
+        Op op = Op::Create;
+
+        // Target, either a live handle or the index of an entity created earlier in this buffer
+        Entity entity = NULL_ENTITY;
+        uint32_t pending = NO_PENDING;
+
+        ComponentType type = 0;
+
+        // Component being added, owned by the buffer until playback relocates it (info = nullptr)
+        void* payload = nullptr;
+        const ComponentInfo* info = nullptr;
+    };
+
+    CommandBuffer() = default;
+    ~CommandBuffer() { Clear(); }
+
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+    // Records a new entity with its initial components, follow-up commands can target the returned handle
+    template<typename... Ts>
+    PendingEntity CreateEntity(Ts... components) {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        const PendingEntity pending{ pendingCount++ };
+        commands.push_back( { Op::Create } );
+        ( Record( Op::Add, NULL_ENTITY, pending.index, std::move(components) ), ... );
+        return pending;
+    }
+
+    void DestroyEntity(Entity entity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        commands.push_back( { Op::Destroy, entity } );
+    }
+
+    void DestroyEntity(PendingEntity entity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        commands.push_back( { Op::Destroy, NULL_ENTITY, entity.index } );
+    }
+
+    template<typename T>
+    void AddComponent(Entity entity, T component) {
+        std::lock_guard<std::mutex> lock(mutex);
+        Record( Op::Add, entity, NO_PENDING, std::move(component) );
+    }
+
+    template<typename T>
+    void AddComponent(PendingEntity entity, T component) {
+        std::lock_guard<std::mutex> lock(mutex);
+        Record( Op::Add, NULL_ENTITY, entity.index, std::move(component) );
+    }
+
+    template<typename T>
+    void RemoveComponent(Entity entity) {
+        std::lock_guard<std::mutex> lock(mutex);
+        commands.push_back( { Op::Remove, entity, NO_PENDING, ComponentTypeId<T>(), nullptr, &ComponentInfoOf<T>() } );
+    }
+
+    // Destroys every payload that was not consumed and resets the buffer, arena blocks are kept for reuse
+    void Clear() {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        for(Command& command : commands) {
+            if( command.payload && command.info ) {
+                command.info->destroy( command.payload );
+            }
+        }
+        commands.clear();
+        oversized.clear();
+
+        pendingCount = 0;
+        blockIndex = 0;
+        blockOffset = 0;
+    }
+
+    [[nodiscard]] bool Empty() const { return commands.empty(); }
+    [[nodiscard]] size_t Size() const { return commands.size(); }
+    [[nodiscard]] uint32_t PendingCount() const { return pendingCount; }
+
+    // Recorded commands, only to be walked at the sync point while nothing else records
+    [[nodiscard]] std::vector<Command>& Commands() { return commands; }
+
+private:
+    template<typename T>
+    void Record(Op op, Entity entity, uint32_t pending, T component) {
+        void* payload = Allocate( sizeof(T), alignof(T) );
+        new ( payload ) T( std::move(component) );
+        commands.push_back( { op, entity, pending, ComponentTypeId<T>(), payload, &ComponentInfoOf<T>() } );
+    }
+
+    // Bump allocation out of stable blocks, payload addresses never move until Clear
+    void* Allocate(size_t size, size_t align) {
+        // Room for the worst case alignment padding
+        const size_t needed = size + align - 1;
+
+        if( needed > BLOCK_BYTES ) {
+            oversized.push_back( std::make_unique<std::byte[]>( needed ) );
+            return AlignUp( oversized.back().get(), align );
+        }
+
+        if( blockIndex == blocks.size() || blockOffset + needed > BLOCK_BYTES ) {
+            if( blockOffset != 0 ) {
+                ++blockIndex;
+                blockOffset = 0;
+            }
+            if( blockIndex == blocks.size() ) {
+                blocks.push_back( std::make_unique<std::byte[]>( BLOCK_BYTES ) );
+            }
+        }
+
+        std::byte* base = blocks[blockIndex].get() + blockOffset;
+        std::byte* aligned = AlignUp( base, align );
+        blockOffset += static_cast<size_t>( aligned - base ) + size;
+        return aligned;
+    }
+
+    static std::byte* AlignUp(std::byte* ptr, size_t align) {
+        const auto address = reinterpret_cast<uintptr_t>( ptr );
+        return ptr + ( ( align - address % align ) % align );
+    }
+
+    std::mutex mutex;
+    std::vector<Command> commands;
+
+    // Number of CreateEntity commands recorded, pending indices count up from 0
+    uint32_t pendingCount = 0;
+
+    // Payload arena
+    std::vector<std::unique_ptr<std::byte[]>> blocks;
+    std::vector<std::unique_ptr<std::byte[]>> oversized;
+    size_t blockIndex = 0;
+    size_t blockOffset = 0;
+};
+
+#endif //COMMAND_BUFFER_HPP
@@ -0,0 +1,36 @@
+/*
+* File: component.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "component.hpp"
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+#include "log.hpp"
+
+namespace Trajan {
+    ComponentType ResolveComponentType(const std::type_info& type) {
+        // Only hit once per type per module, ComponentTypeId<T>() caches the result
+        static std::mutex mutex;
+        static std::unordered_map<std::type_index, ComponentType> types;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto [it, inserted] = types.try_emplace( std::type_index(type), static_cast<ComponentType>( types.size() ) );
+        if( inserted && types.size() > MAX_COMPONENTS ) {
+            Log::Error("More than " + std::to_string(MAX_COMPONENTS) + " component types in use, " + type.name() + " cannot be registered");
+            it->second = MAX_COMPONENTS;
+        }
+        return it->second;
+    }
+}
@@ -13,16 +13,92 @@
 #ifndef COMPONENT_HPP
 #define COMPONENT_HPP
 
+#include <cstddef>
 #include <cstdint>
-#include <bitset>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include "signature.hpp"
+#include "trajan_engine.hpp"
 
 // Component type alias
-using ComponentType = uint8_t;
+using ComponentType = uint16_t;
 
 // Maximum number of components
-const ComponentType MAX_COMPONENTS = 32;
+constexpr ComponentType MAX_COMPONENTS = 256;
 
 // Bitset of component types
-using Signature = std::bitset<MAX_COMPONENTS>;
+using Signature = WideSignature<MAX_COMPONENTS>;
+
+namespace Trajan {
+    // Hands out the process-wide component type for a C++ type.
+    // Lives in the engine library so the engine, editor and game modules all agree on the same IDs.
+    TRAJANENGINE_API ComponentType ResolveComponentType(const std::type_info& type);
+}
+
+// Component type of T, resolved once per type and cached in a function-local static
+template<typename T>
+ComponentType ComponentTypeId() {
+    static const ComponentType type = Trajan::ResolveComponentType( typeid(std::remove_cv_t<T>) );
+    return type;
+}
+
+// Type-erased operations for one component type, used wherever storage only knows the ComponentType
+struct ComponentInfo {
+    size_t size = 0;
+    size_t align = 0;
+    const char* name = "";
+
+    // Empty type, stored as membership only
+    bool tag = false;
+
+    // Move-constructs into uninitialized dst, then destroys src (relocation)
+    void (*moveConstruct)(void* dst, void* src) = nullptr;
+    void (*destroy)(void* ptr) = nullptr;
+};
+
+template<typename T>
+ComponentInfo MakeComponentInfo() {
+    return {
+        sizeof(T),
+        alignof(T),
+        typeid(T).name(),
+        std::is_empty_v<T>,
+        [](void* dst, void* src) {
+            T* from = static_cast<T*>(src);
+            new (dst) T( std::move(*from) );
+            from->~T();
+        },
+        [](void* ptr) {
+            static_cast<T*>(ptr)->~T();
+        }
+    };
+}
+
+// Tag components (empty types like "Static" or "Selected") carry no data, so every owner shares one instance
+template<typename T>
+constexpr bool IsTagComponent = std::is_empty_v<std::remove_const_t<T>>;
+
+template<typename T>
+T& TagInstance() {
+    static_assert(IsTagComponent<T>, "Only tag components share an instance");
+    static T instance{};
+    return instance;
+}
+
+// Shared ComponentInfo instance for T
+template<typename T>
+const ComponentInfo& ComponentInfoOf() {
+    static const ComponentInfo info = MakeComponentInfo<T>();
+    return info;
+}
+
+// Component storage backend, chosen when an Orchestrator is created
+enum class StorageBackend {
+    SparseSet, // One ComponentArray per component type
+    Archetype, // Entities with identical signatures share SoA chunks
+};
 
 #endif //COMPONENT_HPP
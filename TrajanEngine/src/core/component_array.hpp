@@ -13,81 +13,283 @@
 #ifndef COMPONENT_ARRAY_HPP
 #define COMPONENT_ARRAY_HPP
 
-#include <array>
-#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <utility>
+#include <vector>
 
+#include "change_tick.hpp"
+#include "component.hpp"
 #include "entity.hpp"
 #include "log.hpp"
+#include "snapshot.hpp"
+#include "sparse_set.hpp"
+
+// Size of a cache line, the unit parallel iteration splits dense storage on
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// Allocator that starts every dense component buffer on a cache line boundary
+template<typename T>
+struct CacheAlignedAllocator {
+    using value_type = T;
+
+    static constexpr std::align_val_t ALIGNMENT{ std::max( CACHE_LINE_SIZE, alignof(T) ) };
+
+    CacheAlignedAllocator() = default;
+    template<typename U>
+    CacheAlignedAllocator(const CacheAlignedAllocator<U>&) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>( ::operator new( count * sizeof(T), ALIGNMENT ) );
+    }
+
+    void deallocate(T* ptr, size_t) {
+        ::operator delete( ptr, ALIGNMENT );
+    }
+
+    template<typename U>
+    bool operator==(const CacheAlignedAllocator<U>&) const { return true; }
+};
 
 class IComponentArray {
 public:
     virtual ~IComponentArray() = default;
     virtual void EntityDestroyed(Entity entity) = 0;
+
+    // Batch form of EntityDestroyed, one call per pool instead of one per entity
+    virtual void EntitiesDestroyed(std::span<const Entity> entities) = 0;
+
+    // Type-erased insert: relocates the component out of src, src is only consumed when true is returned
+    virtual bool InsertRelocated(Entity entity, void* src, Tick tick) = 0;
+    virtual void Remove(Entity entity) = 0;
+
+    // Owning entities in dense order
+    [[nodiscard]] virtual const SparseSet& Entities() const = 0;
+
+    // Exchanges two dense slots (entity, component and ticks), used by groups to reorder pools
+    virtual void Swap(uint32_t a, uint32_t b) = 0;
+
+    virtual void Clear() = 0;
+
+    // Snapshot support: Save writes the owning entities and their components, Load appends them to
+    // an empty pool stamping every component as added at tick. Load fails on malformed input.
+    [[nodiscard]] virtual const ComponentInfo& Info() const = 0;
+    [[nodiscard]] virtual bool Serializable() const = 0;
+    virtual void Save(SnapshotWriter& out) const = 0;
+    virtual bool Load(SnapshotReader& in, Tick tick) = 0;
 };
 
+// Dense pool of one component type
+// Tag components only keep the membership set: no component data and no change ticks.
 template <typename T>
 class ComponentArray : public IComponentArray {
 public:
-    void InsertData(Entity entity, T component) {
-        if( entityToIndexMap.contains( entity ) ) {
+    static constexpr bool IS_TAG = IsTagComponent<T>;
+
+    // tick = when the component was added, it also counts as changed then
+    void InsertData(Entity entity, T component, Tick tick = 0) {
+        if( entities.Contains( entity ) ) {
             Log::Error("Attempted redundant add of component " + std::string(typeid(T).name()) + " to entity of ID: " + std::to_string(entity) );
             return;
         }
 
-        // Insert entry at end and update map
-        size_t index = size;
-        entityToIndexMap[entity] = index;
-        indexToEntityMap[index] = entity;
-        componentArray[index] = component;
-        size++;
+        // Insert entry at end, dense index matches in all arrays
+        entities.Insert( entity );
+        if constexpr ( !IS_TAG ) {
+            components.push_back( std::move(component) );
+            ticks.push_back( { tick, tick } );
+        }
+    }
+
+    // Gives every entity in a batch its own copy of component, the entities must not already own one
+    void InsertBulk(std::span<const Entity> batch, const T& component, Tick tick = 0) {
+        entities.Reserve( entities.Size() + batch.size() );
+        if constexpr ( !IS_TAG ) {
+            components.reserve( components.size() + batch.size() );
+            ticks.resize( ticks.size() + batch.size(), { tick, tick } );
+        }
+
+        for(Entity entity : batch) {
+            entities.Insert( entity );
+            if constexpr ( !IS_TAG ) {
+                components.push_back( component );
+            }
+        }
     }
 
     void RemoveData(Entity entity) {
-        if( size == 0 ) { return; }
-
-        if( !entityToIndexMap.contains( entity ) ) {
+        if( !entities.Contains( entity ) ) {
             Log::Warn("Tried to remove " + std::string(typeid(T).name()) + " from non-owning entity of ID " + std::to_string(entity) );
             return;
         }
 
-        // Copy element at end into deleted element's place <- Goal is to maintain density
-        size_t indexRemoved = entityToIndexMap[entity];
-        size_t indexLast = size - 1;
-        componentArray[indexRemoved] = componentArray[indexLast];
-
-        // Update the map
-        Entity entityLast = indexToEntityMap[indexLast];
-        entityToIndexMap[entityLast] = indexRemoved;
-        indexToEntityMap[indexRemoved] = entityLast;
+        // Move element at end into deleted element's place <- Goal is to maintain density
+        const size_t indexRemoved = entities.Remove( entity );
+        if constexpr ( IS_TAG ) return;
 
-        entityToIndexMap.erase(entity);
-        indexToEntityMap.erase(indexLast);
-
-        size--;
+        const size_t indexLast = components.size() - 1;
+        if( indexRemoved != indexLast ) {
+            components[indexRemoved] = std::move( components[indexLast] );
+            ticks[indexRemoved] = ticks[indexLast];
+        }
+        components.pop_back();
+        ticks.pop_back();
     }
 
     T* GetData(Entity entity) {
-        auto it = entityToIndexMap.find(entity);
-        if(it == entityToIndexMap.end()) {
-            Log::Error("Entity does not have component"); // TODO: make error better
+        const uint32_t index = entities.Find( entity );
+        if( index == SparseSet::INVALID_INDEX ) {
+            Log::Error("Entity " + std::to_string(entity) + " does not have component " + std::string(typeid(T).name()) );
             return nullptr;
         }
 
-        return &componentArray[it->second];
+        if constexpr ( IS_TAG ) {
+            return &TagInstance<T>();
+        }
+        else {
+            return &components[index];
+        }
+    }
+
+    [[nodiscard]] bool HasData(Entity entity) const {
+        return entities.Contains( entity );
+    }
+
+    // Change ticks of an owned component, nullptr if the entity does not own one
+    ComponentTicks* GetTicks(Entity entity) {
+        if constexpr ( IS_TAG ) return nullptr;
+
+        const uint32_t index = entities.Find( entity );
+        return index == SparseSet::INVALID_INDEX ? nullptr : &ticks[index];
+    }
+
+    bool InsertRelocated(Entity entity, void* src, Tick tick) override {
+        if( entities.Contains( entity ) ) {
+            Log::Error("Attempted redundant add of component " + std::string(typeid(T).name()) + " to entity of ID: " + std::to_string(entity) );
+            return false;
+        }
+
+        T* from = static_cast<T*>(src);
+        InsertData( entity, std::move(*from), tick );
+        from->~T();
+        return true;
+    }
+
+    void Remove(Entity entity) override {
+        RemoveData( entity );
+    }
+
+    void Swap(uint32_t a, uint32_t b) override {
+        if( a == b ) return;
+
+        entities.Swap( a, b );
+        if constexpr ( !IS_TAG ) {
+            std::swap( components[a], components[b] );
+            std::swap( ticks[a], ticks[b] );
+        }
+    }
+
+    void Clear() override {
+        entities.Clear();
+        components.clear();
+        ticks.clear();
+    }
+
+    [[nodiscard]] const ComponentInfo& Info() const override { return ComponentInfoOf<T>(); }
+    [[nodiscard]] bool Serializable() const override { return IsSerializableComponent<T>; }
+
+    void Save(SnapshotWriter& out) const override {
+        out.Write( static_cast<uint32_t>( entities.Size() ) );
+        out.WriteArray( entities.Data(), entities.Size() );
+
+        if constexpr ( IS_TAG ) {
+            return;
+        }
+        else if constexpr ( CustomSerialized<T> ) {
+            for(const T& component : components) {
+                ComponentSerializer<T>::Write( out, component );
+            }
+        }
+        else if constexpr ( std::is_trivially_copyable_v<T> ) {
+            out.WriteArray( components.data(), components.size() );
+        }
+    }
+
+    bool Load(SnapshotReader& in, Tick tick) override {
+        uint32_t count = 0;
+        if( !in.Read( count ) || count > in.Remaining() / sizeof(Entity) ) return false;
+
+        std::vector<Entity> loaded( count );
+        if( !in.ReadArray( loaded.data(), count ) ) return false;
+
+        entities.Reserve( count );
+        for(Entity entity : loaded) {
+            if( entities.Contains( entity ) ) return false;
+            entities.Insert( entity );
+        }
+
+        if constexpr ( !IS_TAG ) {
+            if constexpr ( CustomSerialized<T> ) {
+                components.reserve( count );
+                for(uint32_t i = 0; i < count; ++i) {
+                    T component{};
+                    ComponentSerializer<T>::Read( in, component );
+                    components.push_back( std::move(component) );
+                }
+            }
+            else if constexpr ( std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T> ) {
+                // Bounds check before sizing the pool off an untrusted count
+                if( count > in.Remaining() / sizeof(T) ) return false;
+                components.resize( count );
+                in.ReadArray( components.data(), count );
+            }
+            else {
+                return false;
+            }
+            ticks.assign( count, { tick, tick } );
+        }
+        return !in.Failed();
     }
 
     void EntityDestroyed(Entity entity) override {
-        // This check seems redundant
-        if( entityToIndexMap.contains( entity ) ) {
+        if( entities.Contains( entity ) ) {
             RemoveData(entity);
         }
     }
 
+    void EntitiesDestroyed(std::span<const Entity> batch) override {
+        for(Entity entity : batch) {
+            if( entities.Contains( entity ) ) {
+                RemoveData( entity );
+            }
+        }
+    }
+
+    // Dense access, index i of Entities() owns index i of Components()
+    // Tags: Components() is the single shared instance and Ticks() is nullptr
+    [[nodiscard]] size_t Size() const { return entities.Size(); }
+    [[nodiscard]] const SparseSet& Entities() const override { return entities; }
+    [[nodiscard]] T* Components() {
+        if constexpr ( IS_TAG ) {
+            return &TagInstance<T>();
+        }
+        else {
+            return components.data();
+        }
+    }
+    [[nodiscard]] ComponentTicks* Ticks() { return ticks.data(); }
+
 private:
-    std::array<T, MAX_ENTITIES> componentArray;
-    std::unordered_map<Entity, size_t> entityToIndexMap;
-    std::unordered_map<size_t, Entity> indexToEntityMap;
-    size_t size = 0;
+    // Entity ID <-> dense index
+    SparseSet entities;
+
+    // Packed component data, cache line aligned so parallel chunks split on line boundaries (unused for tags)
+    std::vector<T, CacheAlignedAllocator<T>> components;
+
+    // Added/changed ticks, index-aligned with components
+    std::vector<ComponentTicks> ticks;
 };
 
 #endif //COMPONENT_ARRAY_HPP
@@ -12,94 +12,248 @@
 
 #ifndef COMPONENT_MANAGER_HPP
 #define COMPONENT_MANAGER_HPP
-#include <unordered_map>
-#include <typeindex>
+#include <array>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
 
 #include "component.hpp"
 #include "component_array.hpp"
+#include "group.hpp"
+#include "trajan_engine.hpp"
+
+class SnapshotReader;
+class SnapshotWriter;
 
 class ComponentManager {
 public:
     template<typename T>
     void RegisterComponent() {
-        auto key = std::type_index(typeid(T));
-
-        if( componentTypes.contains(key) ) {
-            Log::Error("Attempted register of component type " + std::string(typeid(T).name()) + " more than once!");
+        if( !RegisterComponentType<T>() ) {
             return;
         }
 
-        // Add the type to the map
-        componentTypes.insert( { key, nextComponentType } );
+        // Create a component array and put it in the slot for its type
+        auto array = std::make_unique<ComponentArray<T>>();
+        componentArrays[ComponentTypeId<T>()] = array.get();
+        ownedArrays.push_back( std::move(array) );
+    }
+
+    // Marks a component type as registered without creating an array (used when another backend owns the storage)
+    template<typename T>
+    bool RegisterComponentType() {
+        const ComponentType type = ComponentTypeId<T>();
+
+        if( type >= MAX_COMPONENTS ) {
+            Log::Error("Component type " + std::string(typeid(T).name()) + " exceeds MAX_COMPONENTS!");
+            return false;
+        }
+
+        if( registered.test( type ) ) {
+            Log::Error("Attempted register of component type " + std::string(typeid(T).name()) + " more than once!");
+            return false;
+        }
 
-        // Create a component array ptr and add it to the map
-        componentArrays.insert( { key, std::make_shared<ComponentArray<T>>() } );
+        registered.set( type );
+        return true;
+    }
 
-        // Increment to the next available register
-        ++nextComponentType;
+    [[nodiscard]] bool IsRegistered(ComponentType type) const {
+        return type < MAX_COMPONENTS && registered.test( type );
     }
 
     template<typename T>
     ComponentType GetComponentType() {
-        auto key = std::type_index(typeid(T));
-        auto it = componentTypes.find( key );
-        if(it == componentTypes.end()) {
+        const ComponentType type = ComponentTypeId<T>();
+        if( type >= MAX_COMPONENTS || !registered.test( type ) ) {
             Log::Assert(false, "Component type not registered"); // TODO: replace when i add throws
         }
-        return it->second;
+        return type;
     }
 
     template<typename T>
-    void AddComponent(Entity entity, T component) {
+    void AddComponent(Entity entity, T component, Tick tick = 0) {
         // Add a component to the array for given entity
-        GetComponentArray<T>()->InsertData(entity, component);
+        GetComponentArray<T>()->InsertData(entity, std::move(component), tick);
+        EnterGroup( entity, ComponentTypeId<T>() );
+    }
+
+    // Copies component into every entity of a batch
+    template<typename T>
+    void AddComponents(std::span<const Entity> batch, const T& component, Tick tick = 0) {
+        GetComponentArray<T>()->InsertBulk( batch, component, tick );
+        if( Group* group = owners[ComponentTypeId<T>()] ) {
+            for(Entity entity : batch) group->Enter( entity );
+        }
+    }
+
+    // Type-erased add, relocating the component out of src (see IComponentArray::InsertRelocated)
+    bool AddComponentRelocated(Entity entity, ComponentType type, void* src, Tick tick) {
+        if( !componentArrays[type]->InsertRelocated( entity, src, tick ) ) {
+            return false;
+        }
+        EnterGroup( entity, type );
+        return true;
     }
 
     template<typename T>
     void RemoveComponent(Entity entity) {
         // Remove a component from the array for given entity
-        GetComponentArray<T>()->RemoveData(entity);
+        RemoveComponent( entity, ComponentTypeId<T>() );
+    }
+
+    void RemoveComponent(Entity entity, ComponentType type) {
+        // Leave the group first so the removal's swap-with-last never lands inside the packed range
+        if( Group* group = owners[type] ) group->Leave( entity );
+        componentArrays[type]->Remove( entity );
     }
 
     template<typename T>
     T& GetComponent(Entity entity) {
         // Return a reference to a component from the array for an entity
         auto arr = GetComponentArray<T>();
-        Log::Assert(arr != nullptr, "Component array does not exist");
+        if( !arr ) {
+            Log::Assert(false, "Component array does not exist");
+        }
         T* ptr = arr->GetData(entity);
-        Log::Assert(ptr != nullptr, "Component not found on entity");
+        if( !ptr ) {
+            Log::Assert(false, "Component not found on entity");
+        }
         return *ptr;
     }
 
     void EntityDestroyed(Entity entity) {
+        for(auto const& group : groups) {
+            group->Leave( entity );
+        }
+
         // Notify all arrays that an entity has been destroyed
-        for(auto const& pair : componentArrays) {
-            auto const& component = pair.second;
+        for(auto const& component : ownedArrays) {
             component->EntityDestroyed(entity);
         }
     }
 
-private:
-    // Map from Component Name (C String) to Component Type (uint8_t)
-    std::unordered_map<std::type_index, ComponentType> componentTypes {};
+    // Batch form of EntityDestroyed, involved = union of the batch's signatures
+    void EntitiesDestroyed(std::span<const Entity> batch, const Signature& involved) {
+        for(auto const& group : groups) {
+            if( !group->Types().Intersects( involved ) ) continue;
+            for(Entity entity : batch) group->Leave( entity );
+        }
 
-    // Map from Component Name (C String) to Component Array
-    std::unordered_map<std::type_index, std::shared_ptr<IComponentArray>> componentArrays {};
+        // One call per pool the batch touches
+        involved.ForEach([&](size_t type) {
+            if( IComponentArray* array = componentArrays[type] ) {
+                array->EntitiesDestroyed( batch );
+            }
+        });
+    }
+
+    /*
+     *  Function: CreateGroup
+     *
+     *  Description:
+     *      Makes Ts... an owning group: from now on their pools keep every entity owning all of
+     *      them packed at the front, index-aligned, so iterating them needs no lookups.
+     *      Fails if a pool is missing or already owned by another group.
+     *
+     *  In:
+     *      none
+     *
+     *  Out:
+     *      Group* - the new group, nullptr on failure
+     */
+    template<typename... Ts>
+    Group* CreateGroup() {
+        static_assert(sizeof...(Ts) > 1, "A group needs at least two component types");
+
+        const std::array<ComponentType, sizeof...(Ts)> types{ ComponentTypeId<Ts>()... };
+
+        Signature signature;
+        std::vector<IComponentArray*> pools;
+        for(ComponentType type : types) {
+            if( type >= MAX_COMPONENTS || !componentArrays[type] ) {
+                Log::Error("Group requested over a component type without a pool");
+                return nullptr;
+            }
+            if( owners[type] ) {
+                Log::Error("Component type " + std::to_string(type) + " is already owned by a group");
+                return nullptr;
+            }
+            signature.set( type );
+            pools.push_back( componentArrays[type] );
+        }
+
+        auto group = std::make_unique<Group>( signature, std::move(pools) );
+        for(ComponentType type : types) {
+            owners[type] = group.get();
+        }
+        groups.push_back( std::move(group) );
+        return groups.back().get();
+    }
+
+    // Writes every serializable pool as name, element size, byte length and contents
+    TRAJANENGINE_API void Save(SnapshotWriter& out) const;
 
-    // Component Types to be assigned to the next registered component (Starts at 0)
-    ComponentType nextComponentType{};
+    // Reads pools written by Save into the matching (empty) pools, unknown pools are skipped with a warning
+    // Returns false on malformed input, leaving the pools partially filled
+    TRAJANENGINE_API bool Load(SnapshotReader& in, Tick tick);
 
-    // Helper: Retrieve statically cast pointer to the ComponentArray of type T
+    // Empties every pool and group
+    void Clear() {
+        for(auto const& array : ownedArrays) {
+            array->Clear();
+        }
+        for(auto const& group : groups) {
+            group->Rebuild();
+        }
+    }
+
+    // Group owning a component type's pool, nullptr if the pool is not grouped
+    [[nodiscard]] Group* GetGroup(ComponentType type) const {
+        return type < MAX_COMPONENTS ? owners[type] : nullptr;
+    }
+
+    // Untyped array for a component type, nullptr if none was created
+    [[nodiscard]] IComponentArray* GetComponentArray(ComponentType type) const {
+        return type < MAX_COMPONENTS ? componentArrays[type] : nullptr;
+    }
+
+    // Retrieve statically cast pointer to the ComponentArray of type T
     template<typename T>
-    std::shared_ptr<ComponentArray<T>> GetComponentArray() {
-        auto key = std::type_index(typeid(T));
-        auto it = componentArrays.find( key );
-        if(it == componentArrays.end()) {
+    ComponentArray<T>* GetComponentArray() {
+        const ComponentType type = ComponentTypeId<T>();
+        if( type >= MAX_COMPONENTS || !componentArrays[type] ) {
             Log::Error("Component of type: " + std::string(typeid(T).name()) + " requested, but not registered.");
             return nullptr;
         }
-        return std::static_pointer_cast<ComponentArray<T>>(it->second);
+        return static_cast<ComponentArray<T>*>( componentArrays[type] );
     }
+
+private:
+    void EnterGroup(Entity entity, ComponentType type) {
+        if( Group* group = owners[type] ) group->Enter( entity );
+    }
+
+    IComponentArray* FindArray(const std::string& name) const {
+        for(auto const& array : ownedArrays) {
+            if( name == array->Info().name ) return array.get();
+        }
+        return nullptr;
+    }
+
+    // Registered component types <- Bit corresponds to component type
+    Signature registered{};
+
+    // Raw array pointers <- Index corresponds to component type (nullptr = no array)
+    std::array<IComponentArray*, MAX_COMPONENTS> componentArrays{};
+
+    // Owning storage for every created array
+    std::vector<std::unique_ptr<IComponentArray>> ownedArrays;
+
+    // Owning groups, and the group owning each pool <- Index corresponds to component type
+    std::vector<std::unique_ptr<Group>> groups;
+    std::array<Group*, MAX_COMPONENTS> owners{};
 };
 
 #endif //COMPONENT_MANAGER_HPP
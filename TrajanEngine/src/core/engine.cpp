@@ -11,14 +11,21 @@
 */
 
 #include "engine.hpp"
+#include <algorithm>
+#include <cmath>
 #include <log.hpp>
 #include <window.hpp>
 #include <opengl_renderer.hpp>
 
+#include "job_system.hpp"
 #include "orchestrator.hpp"
+#include "trace.hpp"
+#include "hierarchy.hpp"
 #include "render_system.hpp"
 #include "sprite.hpp"
 #include "transform_2d.hpp"
+#include "transform_system.hpp"
+#include "world_transform.hpp"
 
 #include "mesh_manager.hpp"
 #include "shader_manager.hpp"
@@ -32,8 +39,13 @@ namespace Trajan {
 
     // Engine member functions
 
-    void Engine::Initialize(int width, int height, const std::string& name, RenderAPI api) {
+    void Engine::Initialize(int width, int height, const std::string& name, RenderAPI api, Entity maxEntities, StorageBackend storage) {
         mActiveAPI = api;
+        TRAJAN_TRACE_THREAD( "Main" );
+
+        // Shared workers for systems, asset loading and the renderer
+        mJobSystem = std::make_shared<JobSystem>();
+        Log::Message( "Initialized job system with " + std::to_string(mJobSystem->WorkerCount()) + " workers" );
 
         mWindow = std::make_shared<Window>(width, height, name, api);
 
@@ -75,39 +87,187 @@ namespace Trajan {
 
         Log::Message( "Initializing ECS Orchestrator..." );
         mOrchestrator = std::make_shared<Orchestrator>();
-        mOrchestrator->Initialize();
+        mOrchestrator->Initialize( maxEntities, storage );
+        mOrchestrator->SetJobSystem( mJobSystem.get() );
 
         Log::Message("Registering components and systems...");
         mOrchestrator->RegisterComponent<Transform2D>();
+        mOrchestrator->RegisterComponent<WorldTransform>();
+        mOrchestrator->RegisterComponent<Hierarchy>();
         mOrchestrator->RegisterComponent<Sprite>();
 
-        mOrchestrator->CreateSystem<RenderSystem, Sprite, Transform2D>();
+        // Transforms are resolved before anything reads WorldTransform, which it attaches to every Transform2D
+        // Transform2D is declared writable: the system reorders its pool (see below)
+        mOrchestrator->CreateSystem<TransformSystem, Transform2D, WorldTransform>();
+        mOrchestrator->DeclareSystemAccess<TransformSystem, const Hierarchy>();
+        mOrchestrator->CreateSystem<RenderSystem, const Sprite, const WorldTransform>();
+
+        // TransformSystem keeps this group in hierarchy order, so it reads locals and writes world matrices linearly
+        if( storage == StorageBackend::SparseSet ) {
+            mOrchestrator->CreateGroup<Transform2D, WorldTransform>();
+        }
 
         // Build init context and init systems
         SystemContext ctx{
             .orchestrator = *mOrchestrator,
             .renderer = *mRenderer,
-            .window = *mWindow
+            .window = *mWindow,
+            .jobs = *mJobSystem,
+            .events = mOrchestrator->GetEventBus()
         };
         mOrchestrator->InitializeSystems(ctx);
 
         Log::Message( "Engine initialized!" );
     }
 
+    namespace {
+        using FrameClock = std::chrono::steady_clock;
+
+        float MillisecondsSince(FrameClock::time_point start) {
+            return std::chrono::duration<float, std::milli>( FrameClock::now() - start ).count();
+        }
+    }
+
     void Engine::BeginFrame() {
+        TRAJAN_TRACE_ZONE( "Engine::BeginFrame" );
+        const auto start = FrameClock::now();
         mRenderer->BeginFrame();
+        mFrameStats.AddPhase( FramePhase::Submit, MillisecondsSince( start ) );
     }
 
+    /*
+     *  Function: Update
+     *
+     *  Description:
+     *      Polls input, advances the simulation and runs the render pass of every system.
+     *      With a fixed timestep dt only feeds the accumulator: as many whole steps as it holds
+     *      are run (capped, so a hitch cannot snowball), and the remainder becomes the alpha
+     *      rendering interpolates with. Otherwise the simulation is stepped once by dt.
+     *
+     *  In:
+     *      dt - wall time of the frame in seconds
+     *
+     *  Out:
+     *      none
+     */
     void Engine::Update(float dt) {
+        TRAJAN_TRACE_ZONE( "Engine::Update" );
+
+        auto start = FrameClock::now();
         if(mWindow) mWindow->PollEvents();
+        mFrameStats.AddPhase( FramePhase::Poll, MillisecondsSince( start ) );
+
+        start = FrameClock::now();
+        if( !IsFixedTimestep() ) {
+            Step( dt );
+            mAlpha = 1.0f;
+        }
+        else {
+            mAccumulator += std::max( dt, 0.0f );
+
+            uint32_t steps = 0;
+            while( mAccumulator >= mFixedStep && steps < mMaxStepsPerFrame ) {
+                Step( static_cast<float>( mFixedStep ) );
+                mAccumulator -= mFixedStep;
+                ++steps;
+            }
+
+            // Out of steps this frame, drop the backlog instead of carrying it into the next one
+            if( mAccumulator >= mFixedStep ) {
+                mAccumulator = std::fmod( mAccumulator, mFixedStep );
+            }
+
+            mAlpha = static_cast<float>( mAccumulator / mFixedStep );
+        }
+        mFrameStats.AddPhase( FramePhase::Update, MillisecondsSince( start ) );
+
+        // Only the main world is drawn
+        start = FrameClock::now();
+        mOrchestrator->RenderSystems( mAlpha );
+        mFrameStats.AddPhase( FramePhase::Submit, MillisecondsSince( start ) );
+    }
+
+    void Engine::Update() {
+        const auto now = std::chrono::steady_clock::now();
+        mFrameTime = mLastFrame == std::chrono::steady_clock::time_point{} ? 0.0f :
+                     std::chrono::duration<float>( now - mLastFrame ).count();
+        mLastFrame = now;
+
+        Update( mFrameTime );
+    }
+
+    void Engine::SetFixedTimestep(float step, uint32_t maxStepsPerFrame) {
+        if( step <= 0.0f || maxStepsPerFrame == 0 ) {
+            Log::Error("Fixed timestep needs a positive step and at least one step per frame");
+            return;
+        }
+
+        mFixedStep = step;
+        mMaxStepsPerFrame = maxStepsPerFrame;
+        mAccumulator = 0.0;
+    }
+
+    void Engine::SetVariableTimestep() {
+        mFixedStep = 0.0;
+        mAccumulator = 0.0;
+        mAlpha = 1.0f;
+    }
+
+    void Engine::Step(float dt) {
+        TRAJAN_TRACE_ZONE( "Engine::Step" );
+
+        // Extra worlds step on the workers, one job each, while the main world updates here
+        std::vector<JobHandle> steps;
+        steps.reserve( mWorlds.size() );
+        for(auto& world : mWorlds) {
+            steps.push_back( mJobSystem->Schedule( [world = world.get(), dt] { world->UpdateSystems( dt ); } ) );
+        }
 
         // Update all systems
         mOrchestrator->UpdateSystems(dt);
+
+        for(const JobHandle& step : steps) {
+            mJobSystem->Wait( step );
+        }
     }
 
+    /*
+     *  Function: EndFrame
+     *
+     *  Description:
+     *      Collects unused assets and presents, then closes the frame's statistics. The frame
+     *      time recorded is the wall time since the previous EndFrame, so it covers everything
+     *      the application did in between, not only the engine phases.
+     *
+     *  In:
+     *      none
+     *
+     *  Out:
+     *      none
+     */
     void Engine::EndFrame() {
+        TRAJAN_TRACE_ZONE( "Engine::EndFrame" );
+
+        const auto start = FrameClock::now();
         mAssetSystem->CollectGarbage();
+        mFrameStats.AddPhase( FramePhase::GC, MillisecondsSince( start ) );
+
         mRenderer->EndFrame();
+
+        const RendererFrameTimings timings = mRenderer->GetFrameTimings();
+        mFrameStats.AddPhase( FramePhase::Submit, timings.submitMs );
+        mFrameStats.AddPhase( FramePhase::Gpu, timings.gpuMs );
+        mFrameStats.AddPhase( FramePhase::Swap, timings.swapMs );
+
+        // The first frame has nothing to be measured against
+        const auto now = FrameClock::now();
+        if( mLastFrameEnd == FrameClock::time_point{} ) {
+            mFrameStats.DiscardFrame();
+        }
+        else {
+            mFrameStats.EndFrame( std::chrono::duration<float, std::milli>( now - mLastFrameEnd ).count() );
+        }
+        mLastFrameEnd = now;
     }
 
     void Engine::Shutdown() {
@@ -115,6 +275,10 @@ namespace Trajan {
 
         // Cleanup all Systems
         mOrchestrator->ShutdownSystems();
+        for(auto& world : mWorlds) {
+            world->ShutdownSystems();
+        }
+        mWorlds.clear();
 
         // Cleanup all assets
         mAssetSystem->UnloadAssets();
@@ -128,7 +292,58 @@ namespace Trajan {
 
 
 
+    Orchestrator* Engine::CreateWorld(const std::function<void(Orchestrator&)>& setup, Entity maxEntities, StorageBackend storage) {
+        auto world = std::make_shared<Orchestrator>();
+        world->Initialize( maxEntities, storage );
+        world->SetJobSystem( mJobSystem.get() );
+
+        setup( *world );
+
+        if( world->HasMainThreadSystems() ) {
+            Log::Error("Extra worlds are updated off the main thread and cannot hold main thread systems");
+            return nullptr;
+        }
+
+        SystemContext ctx{
+            .orchestrator = *world,
+            .renderer = *mRenderer,
+            .window = *mWindow,
+            .jobs = *mJobSystem,
+            .events = world->GetEventBus()
+        };
+        world->InitializeSystems( ctx );
+
+        mWorlds.push_back( world );
+        Log::Message("Created world " + std::to_string(mWorlds.size()));
+        return world.get();
+    }
+
+    void Engine::DestroyWorld(Orchestrator* world) {
+        auto it = std::find_if( mWorlds.begin(), mWorlds.end(), [world](const auto& w) { return w.get() == world; } );
+        if( it == mWorlds.end() ) {
+            Log::Error("Tried to destroy a world not created by this engine");
+            return;
+        }
+
+        (*it)->ShutdownSystems();
+        mWorlds.erase( it );
+    }
+
     bool Engine::ShouldShutdown() const {
         return bShouldClose || (mWindow ? mWindow->ShouldClose() : true);
     }
+
+    bool Engine::SaveWorld(const std::string& path) const {
+        const std::vector<uint8_t> snapshot = mOrchestrator->SaveSnapshot();
+        if( snapshot.empty() ) return false;
+
+        return WriteSnapshotFile( path, snapshot );
+    }
+
+    bool Engine::LoadWorld(const std::string& path) {
+        const auto snapshot = ReadSnapshotFile( path );
+        if( !snapshot ) return false;
+
+        return mOrchestrator->LoadSnapshot( *snapshot, mAssetSystem.get() );
+    }
 }
@@ -13,15 +13,23 @@
 #ifndef ENGINE_HPP
 #define ENGINE_HPP
 
+#include <chrono>
+#include <functional>
+#include <vector>
+
 #include <trajan_engine.hpp>
 #include "i_renderer.hpp"
 #include "asset_system.hpp"
+#include "component.hpp"
+#include "entity.hpp"
+#include "frame_stats.hpp"
 
 class System;
 
 class Window;
 class IRenderer;
 class Orchestrator;
+class JobSystem;
 
 namespace Trajan {
     class TRAJANENGINE_API Engine {
@@ -29,31 +37,106 @@ namespace Trajan {
         Engine() = default;
         ~Engine() = default;
 
-        void Initialize(int width, int height, const std::string& name, RenderAPI api);
+        void Initialize(int width, int height, const std::string& name, RenderAPI api, Entity maxEntities = DEFAULT_MAX_ENTITIES,
+                        StorageBackend storage = StorageBackend::SparseSet);
 
         // Main Loop
         void BeginFrame();
         void Update(float dt);
         void EndFrame();
 
+        // Engine-driven frame: measures the wall time since the previous call itself, then Update(dt)
+        void Update();
+
+        // Fixed timestep: Update(dt) accumulates frame time and runs whole simulation steps of step seconds,
+        // at most maxStepsPerFrame of them (time beyond that is dropped), then renders with the leftover as alpha
+        void SetFixedTimestep(float step, uint32_t maxStepsPerFrame = 5);
+
+        // Default: one simulation step of the frame's dt per Update
+        void SetVariableTimestep();
+
+        [[nodiscard]] bool IsFixedTimestep() const { return mFixedStep > 0.0; }
+
+        // Fraction of a step the last frame was ahead of the simulation (always 1 with a variable timestep)
+        [[nodiscard]] float GetInterpolationAlpha() const { return mAlpha; }
+
+        // Wall time of the last frame measured by Update()
+        [[nodiscard]] float GetFrameTime() const { return mFrameTime; }
+
+        // Frame pacing: percentiles, hitches and per-phase times over the recent frames (measured EndFrame to EndFrame)
+        [[nodiscard]] FrameReport GetFrameReport() const { return mFrameStats.Report(); }
+
+        // Hitch threshold, CSV output and the raw histogram
+        [[nodiscard]] FrameStats& GetFrameStats() { return mFrameStats; }
+
         void Shutdown();
 
         void RequestShutdown() { bShouldClose = true; };
         [[nodiscard]] bool ShouldShutdown() const;
 
+        // Save games: writes/replaces the world from a snapshot file, asset handles are resolved through the asset system
+        bool SaveWorld(const std::string& path) const;
+        bool LoadWorld(const std::string& path);
+
+        /*
+         *  Function: CreateWorld
+         *
+         *  Description:
+         *      Creates an extra simulation world with its own entities, components, systems and events.
+         *      Extra worlds share the engine's asset system and job system, and are stepped in parallel
+         *      (one job per world) alongside the main world in Update. Their systems run off the main
+         *      thread, so they must not issue GPU work.
+         *
+         *  In:
+         *      setup       - registers the world's components and systems, called before they are initialized
+         *      maxEntities - entity limit of the world
+         *      storage     - component storage backend of the world
+         *
+         *  Out:
+         *      Orchestrator* - the new world, owned by the engine, or nullptr if setup was rejected
+         */
+        Orchestrator* CreateWorld(const std::function<void(Orchestrator&)>& setup, Entity maxEntities = DEFAULT_MAX_ENTITIES,
+                                  StorageBackend storage = StorageBackend::SparseSet);
+
+        // Shuts down the world's systems and frees it, must not be called during Update
+        void DestroyWorld(Orchestrator* world);
+
+        [[nodiscard]] size_t WorldCount() const { return mWorlds.size(); }
+
         [[nodiscard]] IRenderer* GetRenderer() const { return mRenderer.get(); }
         [[nodiscard]] Orchestrator* GetOrchestrator() const { return mOrchestrator.get(); }
         [[nodiscard]] AssetSystem* GetAssetSystem() const { return mAssetSystem.get(); }
+        [[nodiscard]] JobSystem* GetJobSystem() const { return mJobSystem.get(); }
 
     private:
+        // One simulation step of every world
+        void Step(float dt);
+
         bool bShouldClose = false;
 
+        // Frame timing, mFixedStep of 0 = variable timestep
+        double mFixedStep = 0.0;
+        uint32_t mMaxStepsPerFrame = 5;
+        double mAccumulator = 0.0;
+        float mAlpha = 1.0f;
+        float mFrameTime = 0.0f;
+        std::chrono::steady_clock::time_point mLastFrame{};
+
+        FrameStats mFrameStats;
+        std::chrono::steady_clock::time_point mLastFrameEnd{};
+
         RenderAPI mActiveAPI = RenderAPI::OpenGL; // Default to OpenGL
 
+        // Declared first so workers outlive everything that schedules onto them
+        std::shared_ptr<JobSystem> mJobSystem;
+
         std::shared_ptr<AssetSystem> mAssetSystem;
         std::shared_ptr<Orchestrator> mOrchestrator;
         std::shared_ptr<IRenderer> mRenderer;
         std::shared_ptr<Window> mWindow;
+
+        // Extra worlds from CreateWorld, destroyed before the assets their components reference
+        std::vector<std::shared_ptr<Orchestrator>> mWorlds;
     };
 }
 
@@ -15,10 +15,34 @@
 
 #include <cstdint>
 
-// Entity Exists as Pure ID
+// Entity exists as a pure handle: low bits are the slot index, high bits the slot's generation.
+// Destroying an entity bumps its slot's generation, so stale handles never alias a recycled slot.
+// A slot whose generation would wrap is retired instead of recycled, so a generation is never handed out twice.
 using Entity = uint32_t;
 
-// Maximum Number of Allocated Entities
-constexpr Entity MAX_ENTITIES = 1024;
+constexpr uint32_t ENTITY_INDEX_BITS = 22;
+constexpr uint32_t ENTITY_GENERATION_BITS = 32 - ENTITY_INDEX_BITS;
+
+constexpr Entity ENTITY_INDEX_MASK = (1u << ENTITY_INDEX_BITS) - 1;
+constexpr Entity ENTITY_GENERATION_MASK = (1u << ENTITY_GENERATION_BITS) - 1;
+
+// Handle that never refers to a living entity (its index is never handed out)
+constexpr Entity NULL_ENTITY = UINT32_MAX;
+
+constexpr Entity EntityIndex(Entity entity) {
+    return entity & ENTITY_INDEX_MASK;
+}
+
+constexpr uint32_t EntityGeneration(Entity entity) {
+    return entity >> ENTITY_INDEX_BITS;
+}
+
+constexpr Entity MakeEntity(uint32_t index, uint32_t generation) {
+    return (index & ENTITY_INDEX_MASK) | ((generation & ENTITY_GENERATION_MASK) << ENTITY_INDEX_BITS);
+}
+
+// Default cap on living entities, the real cap is set at runtime through Engine::Initialize
+// Entity tables only grow to the highest ID in use, so a large cap costs no memory up front
+constexpr Entity DEFAULT_MAX_ENTITIES = 1 << 20;
 
 #endif //ENTITY_HPP
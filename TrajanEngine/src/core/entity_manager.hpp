@@ -12,82 +12,202 @@
 
 #ifndef ENTITYMANAGER_HPP
 #define ENTITYMANAGER_HPP
-#include <array>
+#include <algorithm>
 #include <optional>
-#include <queue>
+#include <vector>
 
 #include "component.hpp"
 #include "entity.hpp"
 #include "log.hpp"
+#include "trajan_engine.hpp"
+
+class SnapshotReader;
+class SnapshotWriter;
 
 class EntityManager {
 public:
-    EntityManager() {
-        // Initialize the queue with all possible entity IDs
-        for(Entity e = 0; e < MAX_ENTITIES; ++e) {
-            availableEntities.push(e);
-        }
-    }
+    explicit EntityManager(Entity maxEntities = DEFAULT_MAX_ENTITIES)
+        : maxEntities(std::min<Entity>( maxEntities, ENTITY_INDEX_MASK )) {}
 
     ~EntityManager() = default;
 
     std::optional<Entity> CreateEntity() {
-        if(livingEntities >= MAX_ENTITIES) {
+        if(livingEntities >= maxEntities) {
             Log::Error("Entity count exceeded!");
             return std::nullopt;
         }
 
-        // Get ID from the front of the queue
-        Entity id = availableEntities.front();
-        availableEntities.pop();
+        Entity id;
+        if( freeHead == ENTITY_INDEX_MASK && slots.size() >= ENTITY_INDEX_MASK ) {
+            Log::Error("Entity IDs exhausted, every slot is in use or retired!");
+            return std::nullopt;
+        }
+
+        if( freeHead != ENTITY_INDEX_MASK ) {
+            // Pop the most recently freed slot, its record holds the next free index and the generation to revive with
+            const uint32_t index = freeHead;
+            freeHead = EntityIndex( slots[index] );
+            id = MakeEntity( index, EntityGeneration( slots[index] ) );
+            slots[index] = id;
+        }
+        else {
+            // No free slots, grow the tables by one
+            id = MakeEntity( static_cast<uint32_t>( slots.size() ), 0 );
+            slots.push_back( id );
+            signatures.emplace_back();
+        }
         ++livingEntities;
 
         return id;
     }
 
+    /*
+     *  Function: CreateEntities
+     *
+     *  Description:
+     *      Allocates count entities at once, all starting with the same signature.
+     *      Either every entity is created or none are.
+     *
+     *  In:
+     *      count     - number of entities to create
+     *      signature - signature given to every new entity
+     *      out       - receives the new handles (appended)
+     *
+     *  Out:
+     *      bool - false if the entity limit would be exceeded
+     */
+    bool CreateEntities(size_t count, const Signature& signature, std::vector<Entity>& out) {
+        if( count > maxEntities - livingEntities ) {
+            Log::Error("Entity count exceeded!");
+            return false;
+        }
+
+        if( count > FreeCount() + ( ENTITY_INDEX_MASK - slots.size() ) ) {
+            Log::Error("Entity IDs exhausted, every slot is in use or retired!");
+            return false;
+        }
+
+        out.reserve( out.size() + count );
+
+        // Recycle freed slots first, then grow the tables once for the rest
+        size_t remaining = count;
+        while( remaining > 0 && freeHead != ENTITY_INDEX_MASK ) {
+            const uint32_t index = freeHead;
+            freeHead = EntityIndex( slots[index] );
+            slots[index] = MakeEntity( index, EntityGeneration( slots[index] ) );
+            signatures[index] = signature;
+            out.push_back( slots[index] );
+            --remaining;
+        }
+
+        const auto first = static_cast<uint32_t>( slots.size() );
+        slots.resize( first + remaining );
+        signatures.resize( first + remaining, signature );
+        for(uint32_t index = first; index < slots.size(); ++index) {
+            slots[index] = MakeEntity( index, 0 );
+            out.push_back( slots[index] );
+        }
+
+        livingEntities += static_cast<uint32_t>( count );
+        return true;
+    }
+
     void DestroyEntity(Entity entity) {
-        if( entity >= MAX_ENTITIES ) {
-            Log::Error("Tried to destroy out-of-range entity ID " + std::to_string(entity));
+        if( !IsAlive( entity ) ) {
+            Log::Error("Tried to destroy dead or out-of-range entity ID " + std::to_string(entity));
             return;
         }
 
+        const uint32_t index = EntityIndex( entity );
+
         // Invalidate signature
-        signatures[entity].reset();
+        signatures[index].reset();
 
-        // Put the destroyed ID at the back of the queue
-        availableEntities.push(entity);
         --livingEntities;
+
+        // Out of generations: reviving the slot would make old handles to it valid again
+        if( EntityGeneration( entity ) == ENTITY_GENERATION_MASK ) {
+            slots[index] = RETIRED_SLOT;
+            ++retiredSlots;
+            return;
+        }
+
+        // Push the slot onto the free list with its next generation
+        slots[index] = MakeEntity( freeHead, EntityGeneration( entity ) + 1 );
+        freeHead = index;
+    }
+
+    // True if the handle refers to a living entity (stale generations are dead)
+    [[nodiscard]] bool IsAlive(Entity entity) const {
+        const uint32_t index = EntityIndex( entity );
+        return index < slots.size() && slots[index] == entity;
     }
 
     void SetSignature(Entity entity, Signature signature) {
-        if( entity >= MAX_ENTITIES ) {
-            Log::Error("Entity ID " + std::to_string(entity) + " out of range!");
+        if( !IsAlive( entity ) ) {
+            Log::Error("Entity ID " + std::to_string(entity) + " is not alive!");
             return;
         }
 
         // Put this entity's signature into the array
-        signatures[entity] = signature;
+        signatures[EntityIndex( entity )] = signature;
     }
 
     std::optional<Signature> GetSignature(Entity entity) {
-        if( entity >= MAX_ENTITIES ) {
-            Log::Error("Entity ID " + std::to_string(entity) + " out of range!");
+        if( !IsAlive( entity ) ) {
+            Log::Error("Entity ID " + std::to_string(entity) + " is not alive!");
             return std::nullopt;
         }
 
         // Get the entity's signature from the array
-        return signatures[entity];
+        return signatures[EntityIndex( entity )];
+    }
+
+    // Appends every living entity, in index order
+    void LivingEntities(std::vector<Entity>& out) const {
+        out.reserve( out.size() + livingEntities );
+        for(uint32_t index = 0; index < slots.size(); ++index) {
+            if( EntityIndex( slots[index] ) == index ) out.push_back( slots[index] );
+        }
     }
 
+    // Writes the slot table (handles, generations and free list), signatures are rebuilt from the pools on load
+    TRAJANENGINE_API void Save(SnapshotWriter& out) const;
+
+    // Replaces the slot table with one written by Save, every signature starts empty
+    TRAJANENGINE_API bool Load(SnapshotReader& in);
+
+    [[nodiscard]] uint32_t LivingCount() const { return livingEntities; }
+    [[nodiscard]] Entity MaxEntities() const { return maxEntities; }
+
+    // Slots that ran out of generations and are never handed out again
+    [[nodiscard]] uint32_t RetiredCount() const { return retiredSlots; }
+
 private:
-    // Queue of unused entity ID
-    std::queue<Entity> availableEntities;
+    // Record of a retired slot, its index never matches the slot so it reads as dead and is not on the free list
+    static constexpr Entity RETIRED_SLOT = MakeEntity( ENTITY_INDEX_MASK, ENTITY_GENERATION_MASK );
+
+    [[nodiscard]] size_t FreeCount() const { return slots.size() - livingEntities - retiredSlots; }
 
-    // Array of signatures <- Index corresponds to entity ID
-    std::array<Signature, MAX_ENTITIES> signatures{};
+    // Slot records <- Index corresponds to entity index
+    // Living slot: the entity's current handle
+    // Free slot:   index of the next free slot + generation the slot is revived with (intrusive free list)
+    std::vector<Entity> slots{};
+
+    // Signatures <- Index corresponds to entity index
+    std::vector<Signature> signatures{};
+
+    // Head of the free list (ENTITY_INDEX_MASK = empty)
+    uint32_t freeHead = ENTITY_INDEX_MASK;
 
     // Total living entity count
     uint32_t livingEntities{};
+
+    // Slots retired after their last generation
+    uint32_t retiredSlots{};
+
+    // Cap on living entities
+    Entity maxEntities;
 };
 
 #endif //ENTITYMANAGER_HPP
@@ -0,0 +1,30 @@
+/*
+* File: event_bus.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "event_bus.hpp"
+
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace Trajan {
+    EventType ResolveEventType(const std::type_info& type) {
+        // Only hit once per type per module, EventTypeId<T>() caches the result
+        static std::mutex mutex;
+        static std::unordered_map<std::type_index, EventType> types;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto [it, inserted] = types.try_emplace( std::type_index(type), static_cast<EventType>( types.size() ) );
+        return it->second;
+    }
+}
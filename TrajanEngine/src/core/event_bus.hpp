@@ -0,0 +1,195 @@
+/*
+* File: event_bus.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef EVENT_BUS_HPP
+#define EVENT_BUS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "log.hpp"
+#include "trajan_engine.hpp"
+
+// Event type alias
+using EventType = uint16_t;
+
+namespace Trajan {
+    // Hands out the process-wide event type for a C++ type, same scheme as ResolveComponentType
+    TRAJANENGINE_API EventType ResolveEventType(const std::type_info& type);
+}
+
+template<typename T>
+EventType EventTypeId() {
+    static const EventType type = Trajan::ResolveEventType( typeid(std::remove_cv_t<T>) );
+    return type;
+}
+
+// Events published per frame before a queue first has to grow
+constexpr uint32_t DEFAULT_EVENT_CAPACITY = 256;
+
+class IEventQueue {
+public:
+    virtual ~IEventQueue() = default;
+
+    // Frame boundary: this frame's events become readable, the previous frame's are dropped
+    virtual void Swap() = 0;
+    virtual void Clear() = 0;
+};
+
+/*
+ *  Double-buffered queue for one event type.
+ *  Producers claim slots in the write buffer with a single atomic increment, so publishing from
+ *  parallel jobs takes no lock and never allocates. Consumers read last frame's buffer as one span.
+ *  A buffer that overflows drops the extra events and is grown at the next Swap.
+ */
+template<typename T>
+class EventQueue : public IEventQueue {
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "Events are copied into preallocated slots and never destroyed, they must be trivially copyable");
+
+public:
+    explicit EventQueue(uint32_t capacity) {
+        buffers[0].Allocate( capacity );
+        buffers[1].Allocate( capacity );
+    }
+
+    // Safe to call from any thread, returns false if the event was dropped
+    bool Publish(const T& event) {
+        Buffer& buffer = buffers[writeIndex];
+        const uint32_t slot = buffer.count.fetch_add( 1, std::memory_order_relaxed );
+        if( slot >= buffer.capacity ) return false;
+
+        new (buffer.events.get() + slot) T( event );
+        return true;
+    }
+
+    // Events published during the previous frame, in no particular order across threads
+    [[nodiscard]] std::span<const T> Read() const {
+        const Buffer& buffer = buffers[writeIndex ^ 1];
+        return { buffer.events.get(), std::min( buffer.count.load( std::memory_order_relaxed ), buffer.capacity ) };
+    }
+
+    // Must not run concurrently with Publish (called at the frame sync point)
+    void Swap() override {
+        Buffer& written = buffers[writeIndex];
+        const uint32_t published = written.count.load( std::memory_order_acquire );
+
+        writeIndex ^= 1;
+        Buffer& next = buffers[writeIndex];
+
+        if( published > written.capacity ) {
+            Log::Warn("Event queue for " + std::string(typeid(T).name()) + " dropped " +
+                      std::to_string( published - written.capacity ) + " events, growing");
+        }
+
+        // Size the reused buffer for the worst frame so far
+        if( published > next.capacity ) {
+            next.Allocate( std::max( published, next.capacity * 2 ) );
+        }
+        next.count.store( 0, std::memory_order_release );
+    }
+
+    void Clear() override {
+        buffers[0].count.store( 0, std::memory_order_relaxed );
+        buffers[1].count.store( 0, std::memory_order_relaxed );
+    }
+
+private:
+    struct Buffer {
+        void Allocate(uint32_t size) {
+            // Raw storage, events are constructed in place on publish
+            events.reset( static_cast<T*>( ::operator new( sizeof(T) * size, std::align_val_t{ alignof(T) } ) ) );
+            capacity = size;
+        }
+
+        struct Release {
+            void operator()(T* ptr) const { ::operator delete( ptr, std::align_val_t{ alignof(T) } ); }
+        };
+
+        std::unique_ptr<T, Release> events;
+        uint32_t capacity = 0;
+
+        // Slots claimed this frame, may run past capacity when events were dropped
+        std::atomic<uint32_t> count{ 0 };
+    };
+
+    Buffer buffers[2];
+    uint32_t writeIndex = 0;
+};
+
+// Typed event channels shared by every system of a world
+// Events published during frame N are readable during frame N+1, then discarded.
+class EventBus {
+public:
+    // Queues are created up front so publishing never has to touch the queue table
+    template<typename T>
+    void RegisterEvent(uint32_t capacity = DEFAULT_EVENT_CAPACITY) {
+        const EventType type = EventTypeId<T>();
+        if( type >= queues.size() ) {
+            queues.resize( type + 1 );
+        }
+
+        if( queues[type] ) {
+            Log::Error("Attempted register of event type " + std::string(typeid(T).name()) + " more than once!");
+            return;
+        }
+
+        queues[type] = std::make_unique<EventQueue<T>>( std::max<uint32_t>( capacity, 1 ) );
+    }
+
+    template<typename T>
+    bool Publish(const T& event) {
+        EventQueue<T>* queue = GetQueue<T>();
+        return queue && queue->Publish( event );
+    }
+
+    template<typename T>
+    [[nodiscard]] std::span<const T> Read() const {
+        const EventQueue<T>* queue = GetQueue<T>();
+        return queue ? queue->Read() : std::span<const T>{};
+    }
+
+    void Swap() {
+        for(auto& queue : queues) {
+            if( queue ) queue->Swap();
+        }
+    }
+
+    void Clear() {
+        for(auto& queue : queues) {
+            if( queue ) queue->Clear();
+        }
+    }
+
+    template<typename T>
+    [[nodiscard]] EventQueue<T>* GetQueue() const {
+        const EventType type = EventTypeId<T>();
+        if( type >= queues.size() || !queues[type] ) {
+            Log::Error("Event type " + std::string(typeid(T).name()) + " not registered!");
+            return nullptr;
+        }
+        return static_cast<EventQueue<T>*>( queues[type].get() );
+    }
+
+private:
+    std::vector<std::unique_ptr<IEventQueue>> queues;
+};
+
+#endif //EVENT_BUS_HPP
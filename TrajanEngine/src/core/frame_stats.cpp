@@ -0,0 +1,186 @@
+/*
+* File: frame_stats.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "frame_stats.hpp"
+
+#include <algorithm>
+
+#include "log.hpp"
+
+namespace {
+    // Frames needed before the median is trusted for hitch detection
+    constexpr uint32_t HITCH_WARMUP_FRAMES = 30;
+
+    size_t BucketOf(float ms) {
+        const auto bucket = static_cast<size_t>( std::max( ms, 0.0f ) / FRAME_HISTOGRAM_BUCKET_MS );
+        return std::min( bucket, FRAME_HISTOGRAM_BUCKETS - 1 );
+    }
+}
+
+const char* FramePhaseName(FramePhase phase) {
+    switch( phase ) {
+        case FramePhase::Poll: return "poll";
+        case FramePhase::Update: return "update";
+        case FramePhase::Submit: return "submit";
+        case FramePhase::Gpu: return "gpu";
+        case FramePhase::Swap: return "swap";
+        case FramePhase::GC: return "gc";
+        default: return "unknown";
+    }
+}
+
+/*
+ *  Function: EndFrame
+ *
+ *  Description:
+ *      Pushes the frame into the ring, evicting the oldest one from the histogram and the
+ *      hitch count, and writes a CSV row when the output interval has passed.
+ *
+ *  In:
+ *      frameMs - wall time of the frame
+ *
+ *  Out:
+ *      none
+ */
+void FrameStats::EndFrame(float frameMs) {
+    // Judged against the frames before it, so one hitch cannot raise its own bar
+    const bool hitch = count >= HITCH_WARMUP_FRAMES && frameMs > Percentile( 0.5f ) * hitchFactor;
+
+    if( count == FRAME_STATS_HISTORY ) {
+        --histogram[BucketOf( frames[head].totalMs )];
+        windowHitches -= hitchFlags[head];
+    }
+    else {
+        ++count;
+    }
+
+    frames[head].totalMs = frameMs;
+    frames[head].phaseMs = current;
+    hitchFlags[head] = hitch ? 1 : 0;
+    ++histogram[BucketOf( frameMs )];
+    head = ( head + 1 ) % FRAME_STATS_HISTORY;
+    current.fill( 0.0f );
+
+    if( hitch ) {
+        ++windowHitches;
+        ++totalHitches;
+    }
+
+    if( csv.is_open() ) {
+        csvElapsedMs += frameMs;
+        csvTimeMs += frameMs;
+        if( csvElapsedMs >= csvIntervalMs ) {
+            csvElapsedMs = 0.0f;
+            WriteCsvRow();
+        }
+    }
+}
+
+FrameReport FrameStats::Report() const {
+    FrameReport report;
+    report.frames = count;
+    report.hitches = windowHitches;
+    report.totalHitches = totalHitches;
+    if( count == 0 ) return report;
+
+    float total = 0.0f;
+    for(uint32_t i = 0; i < count; ++i) {
+        total += frames[i].totalMs;
+        report.maxMs = std::max( report.maxMs, frames[i].totalMs );
+        for(size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+            report.phaseAvgMs[phase] += frames[i].phaseMs[phase];
+        }
+    }
+    for(float& phase : report.phaseAvgMs) {
+        phase /= static_cast<float>( count );
+    }
+
+    report.avgMs = total / static_cast<float>( count );
+
+    // Bucket edges can overshoot the slowest frame
+    report.p50Ms = std::min( Percentile( 0.50f ), report.maxMs );
+    report.p95Ms = std::min( Percentile( 0.95f ), report.maxMs );
+    report.p99Ms = std::min( Percentile( 0.99f ), report.maxMs );
+    return report;
+}
+
+// Upper edge of the bucket holding the percentile, the overflow bucket reports the slowest frame instead
+float FrameStats::Percentile(float fraction) const {
+    if( count == 0 ) return 0.0f;
+
+    const auto rank = static_cast<uint32_t>( fraction * static_cast<float>( count - 1 ) );
+    uint32_t seen = 0;
+    for(size_t bucket = 0; bucket < FRAME_HISTOGRAM_BUCKETS - 1; ++bucket) {
+        seen += histogram[bucket];
+        if( seen > rank ) return static_cast<float>( bucket + 1 ) * FRAME_HISTOGRAM_BUCKET_MS;
+    }
+
+    float slowest = 0.0f;
+    for(uint32_t i = 0; i < count; ++i) {
+        slowest = std::max( slowest, frames[i].totalMs );
+    }
+    return slowest;
+}
+
+void FrameStats::SetHitchFactor(float factor) {
+    if( factor <= 1.0f ) {
+        Log::Error("Hitch factor must be greater than 1");
+        return;
+    }
+    hitchFactor = factor;
+}
+
+bool FrameStats::SetCsvOutput(const std::string& path, float intervalSeconds) {
+    if( csv.is_open() ) csv.close();
+    if( path.empty() ) return true;
+
+    csv.open( path, std::ios::out | std::ios::trunc );
+    if( !csv ) {
+        Log::Error("Could not open frame stats file " + path + " for writing");
+        return false;
+    }
+
+    csvIntervalMs = std::max( intervalSeconds, 0.0f ) * 1000.0f;
+    csvElapsedMs = 0.0f;
+    csvTimeMs = 0.0;
+
+    csv << "time_s,frames,avg_ms,p50_ms,p95_ms,p99_ms,max_ms,hitches,total_hitches";
+    for(size_t phase = 0; phase < FRAME_PHASE_COUNT; ++phase) {
+        csv << ',' << FramePhaseName( static_cast<FramePhase>( phase ) ) << "_ms";
+    }
+    csv << '\n';
+    return true;
+}
+
+void FrameStats::WriteCsvRow() {
+    const FrameReport report = Report();
+
+    csv << csvTimeMs / 1000.0 << ',' << report.frames << ',' << report.avgMs << ',' << report.p50Ms << ','
+        << report.p95Ms << ',' << report.p99Ms << ',' << report.maxMs << ',' << report.hitches << ','
+        << report.totalHitches;
+    for(float phase : report.phaseAvgMs) {
+        csv << ',' << phase;
+    }
+
+    // Flushed so the file is usable while the engine runs, or after a crash
+    csv << std::endl;
+}
+
+void FrameStats::Reset() {
+    histogram.fill( 0 );
+    hitchFlags.fill( 0 );
+    current.fill( 0.0f );
+    head = 0;
+    count = 0;
+    windowHitches = 0;
+    totalHitches = 0;
+}
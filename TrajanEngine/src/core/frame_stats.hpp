@@ -0,0 +1,137 @@
+/*
+* File: frame_stats.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef FRAME_STATS_HPP
+#define FRAME_STATS_HPP
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <span>
+#include <string>
+
+#include "trajan_engine.hpp"
+
+// Phases of the engine main loop, timed every frame
+enum class FramePhase : uint8_t {
+    Poll,       // window events
+    Update,     // simulation steps of every world
+    Submit,     // render systems, recording and issuing draw commands
+    Gpu,        // GPU execution of the frame's commands (reported a few frames late)
+    Swap,       // buffer swap, includes waiting on vsync
+    GC,         // asset garbage collection
+    Count
+};
+
+constexpr size_t FRAME_PHASE_COUNT = static_cast<size_t>( FramePhase::Count );
+
+// Frames the rolling statistics cover
+constexpr size_t FRAME_STATS_HISTORY = 1024;
+
+// Histogram buckets, FRAME_HISTOGRAM_BUCKET_MS wide, the last one collects everything slower
+constexpr float FRAME_HISTOGRAM_BUCKET_MS = 0.25f;
+constexpr size_t FRAME_HISTOGRAM_BUCKETS = 400;
+
+TRAJANENGINE_API const char* FramePhaseName(FramePhase phase);
+
+// Summary of the recorded frames, times in milliseconds
+struct FrameReport {
+    uint32_t frames = 0;
+
+    float avgMs = 0.0f;
+    float p50Ms = 0.0f;
+    float p95Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+
+    // Frames over the hitch threshold, within the window and since the last Reset
+    uint32_t hitches = 0;
+    uint64_t totalHitches = 0;
+
+    // Average time per phase over the window
+    std::array<float, FRAME_PHASE_COUNT> phaseAvgMs{};
+};
+
+/*
+ *  Rolling frame-time statistics of the main loop.
+ *  Percentiles come from a histogram of the last FRAME_STATS_HISTORY frames, so they are exact to a
+ *  bucket width and cost the same no matter how long the engine has been running.
+ *  A hitch is a frame taking more than hitchFactor times the rolling median.
+ *  Main thread only.
+ */
+class TRAJANENGINE_API FrameStats {
+public:
+    // Adds to the phase's time for the frame in progress
+    void AddPhase(FramePhase phase, float ms) { current[static_cast<size_t>( phase )] += ms; }
+
+    // Closes the frame in progress with its wall time
+    void EndFrame(float frameMs);
+
+    // Drops the phase times of the frame in progress without recording it
+    void DiscardFrame() { current.fill( 0.0f ); }
+
+    [[nodiscard]] FrameReport Report() const;
+
+    // Frame counts per bucket over the window
+    [[nodiscard]] std::span<const uint32_t> Histogram() const { return histogram; }
+
+    // Frames slower than factor x median count as hitches
+    void SetHitchFactor(float factor);
+
+    /*
+     *  Function: SetCsvOutput
+     *
+     *  Description:
+     *      Appends a row with the current report to a CSV file every interval seconds of
+     *      recorded frame time. The file is truncated and given a header first.
+     *      An empty path stops the output.
+     *
+     *  In:
+     *      path            - CSV file to write
+     *      intervalSeconds - frame time between rows
+     *
+     *  Out:
+     *      bool - false if the file could not be opened
+     */
+    bool SetCsvOutput(const std::string& path, float intervalSeconds = 1.0f);
+
+    void Reset();
+
+private:
+    [[nodiscard]] float Percentile(float fraction) const;
+    void WriteCsvRow();
+
+    struct Frame {
+        float totalMs = 0.0f;
+        std::array<float, FRAME_PHASE_COUNT> phaseMs{};
+    };
+
+    // Ring of the last FRAME_STATS_HISTORY frames and the histogram of their totals
+    std::array<Frame, FRAME_STATS_HISTORY> frames{};
+    std::array<uint32_t, FRAME_HISTOGRAM_BUCKETS> histogram{};
+    std::array<uint8_t, FRAME_STATS_HISTORY> hitchFlags{};
+    uint32_t head = 0;
+    uint32_t count = 0;
+
+    std::array<float, FRAME_PHASE_COUNT> current{};
+
+    float hitchFactor = 2.0f;
+    uint32_t windowHitches = 0;
+    uint64_t totalHitches = 0;
+
+    std::ofstream csv;
+    float csvIntervalMs = 0.0f;
+    float csvElapsedMs = 0.0f;
+    double csvTimeMs = 0.0;
+};
+
+#endif //FRAME_STATS_HPP
@@ -0,0 +1,102 @@
+/*
+* File: group.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef GROUP_HPP
+#define GROUP_HPP
+
+#include <span>
+#include <vector>
+
+#include "component.hpp"
+#include "component_array.hpp"
+
+// Owning group over a set of sparse set pools
+// Entities owning every grouped type are packed at the front of each pool, in the same order,
+// so dense index i of every owned pool belongs to the same entity for i < Size().
+// A pool can be owned by at most one group, since two groups would fight over its order.
+class Group {
+public:
+    Group(Signature types, std::vector<IComponentArray*> pools)
+        : types(types), pools(std::move(pools))
+    {
+        Rebuild();
+    }
+
+    // Re-packs the group from scratch, for pools that were filled behind its back (e.g. snapshot loads)
+    void Rebuild() {
+        size = 0;
+
+        // Pull in entities that qualify, walking a copy since Enter reorders the pool
+        const SparseSet& lead = pools.front()->Entities();
+        const std::vector<Entity> existing( lead.begin(), lead.end() );
+        for(Entity entity : existing) {
+            Enter( entity );
+        }
+    }
+
+    // Call after entity gained an owned component, packs it into the group once it owns all of them
+    void Enter(Entity entity) {
+        if( Contains( entity ) ) return;
+
+        for(IComponentArray* pool : pools) {
+            if( !pool->Entities().Contains( entity ) ) return;
+        }
+
+        for(IComponentArray* pool : pools) {
+            pool->Swap( pool->Entities().Index( entity ), static_cast<uint32_t>( size ) );
+        }
+        ++size;
+    }
+
+    // Call before entity loses an owned component (or is destroyed), moves it behind the packed range
+    void Leave(Entity entity) {
+        if( !Contains( entity ) ) return;
+
+        --size;
+        for(IComponentArray* pool : pools) {
+            pool->Swap( pool->Entities().Index( entity ), static_cast<uint32_t>( size ) );
+        }
+    }
+
+    // Reorders the packed range to follow order (non-members are skipped), returns how many entities were placed
+    // Lets a system lay the group out in the order it walks it, e.g. parents before children
+    size_t Arrange(std::span<const Entity> order) {
+        uint32_t next = 0;
+        for(Entity entity : order) {
+            if( !Contains( entity ) ) continue;
+
+            const uint32_t at = pools.front()->Entities().Index( entity );
+            for(IComponentArray* pool : pools) {
+                pool->Swap( at, next );
+            }
+            ++next;
+        }
+        return next;
+    }
+
+    [[nodiscard]] bool Contains(Entity entity) const {
+        return pools.front()->Entities().Find( entity ) < size;
+    }
+
+    // Number of packed entities, the first Size() slots of every owned pool
+    [[nodiscard]] size_t Size() const { return size; }
+
+    // Owned component types
+    [[nodiscard]] const Signature& Types() const { return types; }
+
+private:
+    Signature types;
+    std::vector<IComponentArray*> pools;
+    size_t size = 0;
+};
+
+#endif //GROUP_HPP
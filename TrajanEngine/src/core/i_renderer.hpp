@@ -122,6 +122,14 @@ struct FrameData {
     Vector3 cameraPos = Vector3(0.0f);
 };
 
+// ------------ Frame Timings ------------
+// Measured by the renderer during its last EndFrame, in milliseconds
+struct RendererFrameTimings {
+    float submitMs = 0.0f;  // CPU time issuing the frame's commands
+    float gpuMs = 0.0f;     // GPU time of a recent frame, 0 if the backend cannot measure it
+    float swapMs = 0.0f;    // CPU time presenting
+};
+
 // ------------ Abstract Render Command ------------
 struct RenderCommand {
     enum class Type {
@@ -154,6 +162,9 @@ public:
     virtual void SubmitRenderCommand(const RenderCommand& cmd) = 0;
     virtual void EndFrame() = 0;
 
+    // Timings of the last EndFrame, backends without instrumentation report zeros
+    [[nodiscard]] virtual RendererFrameTimings GetFrameTimings() const { return {}; }
+
     // imgui Context
     [[nodiscard]] virtual ImGuiContext* GetImGuiContext() const = 0;
 
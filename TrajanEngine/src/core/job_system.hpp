@@ -0,0 +1,372 @@
+/*
+* File: job_system.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "trace.hpp"
+
+class JobSystem;
+
+namespace JobDetail {
+    struct Job;
+
+    // Completion state shared by a job and everyone waiting on it
+    struct JobState {
+        // 1 for the job itself + 1 per child not yet finished (children count their own children)
+        std::atomic<uint32_t> unfinished{ 1 };
+
+        // Enclosing job (fork/join), released once this job and all of its children are done
+        std::shared_ptr<JobState> parent;
+
+        // Jobs that list this one as a dependency, released on completion
+        std::mutex mutex;
+        std::vector<std::shared_ptr<Job>> waiters;
+        bool complete = false;
+    };
+
+    struct Job {
+        std::function<void()> fn;
+        std::shared_ptr<JobState> state;
+
+        // Unfinished dependencies, plus one guard held while they are being registered
+        std::atomic<uint32_t> blockers{ 1 };
+    };
+}
+
+// Reference to a scheduled job, cheap to copy
+class JobHandle {
+public:
+    JobHandle() = default;
+
+    // True once the job and all of its children finished (an empty handle is always done)
+    [[nodiscard]] bool Done() const {
+        return !state || state->unfinished.load( std::memory_order_acquire ) == 0;
+    }
+
+    [[nodiscard]] bool Valid() const { return state != nullptr; }
+
+private:
+    friend class JobSystem;
+    explicit JobHandle(std::shared_ptr<JobDetail::JobState> state) : state(std::move(state)) {}
+
+    std::shared_ptr<JobDetail::JobState> state;
+};
+
+// Engine-wide work-stealing worker pool
+// Every worker owns a deque: it pushes and pops at the back, idle workers steal from the front of others.
+// Waiting threads help run jobs, so waiting inside a job (fork/join) never blocks a worker.
+class JobSystem {
+public:
+    // 0 = one worker per hardware thread, minus the main thread
+    explicit JobSystem(unsigned workerCount = 0) {
+        if( workerCount == 0 ) {
+            workerCount = std::max( 2u, std::thread::hardware_concurrency() ) - 1;
+        }
+
+        queues.reserve( workerCount );
+        for(unsigned i = 0; i < workerCount; ++i) {
+            queues.push_back( std::make_unique<WorkerQueue>() );
+        }
+
+        workers.reserve( workerCount );
+        for(unsigned i = 0; i < workerCount; ++i) {
+            workers.emplace_back( [this, i] { WorkerLoop( i ); } );
+        }
+    }
+
+    ~JobSystem() {
+        {
+            std::lock_guard<std::mutex> lock(sleepMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+
+        for(auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    [[nodiscard]] size_t WorkerCount() const { return workers.size(); }
+
+    /*
+     *  Function: Schedule
+     *
+     *  Description:
+     *      Queues fn to run once every dependency is done. Jobs scheduled from inside another
+     *      job become its children: the enclosing job's handle is only done once they are.
+     *
+     *  In:
+     *      fn           - work to run on a worker
+     *      dependencies - jobs that must finish first
+     *
+     *  Out:
+     *      JobHandle - handle to wait on or depend on
+     */
+    JobHandle Schedule(std::function<void()> fn, std::initializer_list<JobHandle> dependencies = {}) {
+        return Schedule( std::move(fn), dependencies.begin(), dependencies.size() );
+    }
+
+    JobHandle Schedule(std::function<void()> fn, const std::vector<JobHandle>& dependencies) {
+        return Schedule( std::move(fn), dependencies.data(), dependencies.size() );
+    }
+
+    /*
+     *  Function: ParallelFor
+     *
+     *  Description:
+     *      Splits [0, count) into ranges of at most grain elements and runs fn(begin, end) on
+     *      each range in parallel. The returned handle is done once every range is.
+     *
+     *  In:
+     *      count        - number of elements
+     *      grain        - elements per job, 0 = split evenly across the workers
+     *      fn           - callable as fn(size_t begin, size_t end)
+     *      dependencies - jobs that must finish before any range runs
+     *
+     *  Out:
+     *      JobHandle - handle covering every range
+     */
+    template<typename Fn>
+    JobHandle ParallelFor(size_t count, size_t grain, Fn fn, std::initializer_list<JobHandle> dependencies = {}) {
+        if( grain == 0 ) {
+            grain = std::max<size_t>( 1, count / ( ( workers.size() + 1 ) * 4 ) );
+        }
+
+        // Root job forks one child per range, so its handle joins them all
+        // Children share fn, the root job is gone by the time they run
+        auto shared = std::make_shared<Fn>( std::move(fn) );
+        return Schedule( [this, count, grain, shared] {
+            for(size_t begin = 0; begin < count; begin += grain) {
+                const size_t end = std::min( count, begin + grain );
+                Schedule( [shared, begin, end] { (*shared)( begin, end ); } );
+            }
+        }, dependencies );
+    }
+
+    // Blocks until handle is done, running other jobs in the meantime
+    // With nothing left to run it sleeps until a job completes or new work is queued.
+    void Wait(const JobHandle& handle) {
+        while( !handle.Done() ) {
+            if( RunOne() ) continue;
+
+            // Announced before the check, so a job finishing in between sees it and wakes us
+            blockedWaiters.fetch_add( 1, std::memory_order_relaxed );
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            {
+                std::unique_lock<std::mutex> lock(sleepMutex);
+                wake.wait( lock, [this, &handle] { return handle.Done() || queued > 0; } );
+            }
+            blockedWaiters.fetch_sub( 1, std::memory_order_relaxed );
+        }
+    }
+
+    // Fork/join helper: schedule then wait
+    void Run(std::function<void()> fn) {
+        Wait( Schedule( std::move(fn) ) );
+    }
+
+private:
+    using JobPtr = std::shared_ptr<JobDetail::Job>;
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<JobPtr> jobs;
+    };
+
+    // Worker index of the calling thread, or -1 outside this job system
+    static int& WorkerIndex() {
+        static thread_local int index = -1;
+        return index;
+    }
+
+    // Job the calling thread is running, parent of anything it schedules
+    static std::shared_ptr<JobDetail::JobState>& CurrentJob() {
+        static thread_local std::shared_ptr<JobDetail::JobState> current;
+        return current;
+    }
+
+    JobHandle Schedule(std::function<void()> fn, const JobHandle* dependencies, size_t dependencyCount) {
+        auto job = std::make_shared<JobDetail::Job>();
+        job->fn = std::move(fn);
+        job->state = std::make_shared<JobDetail::JobState>();
+
+        // Inside a job: the new job is a child of it
+        if( CurrentJob() ) {
+            job->state->parent = CurrentJob();
+            job->state->parent->unfinished.fetch_add( 1, std::memory_order_relaxed );
+        }
+
+        for(size_t i = 0; i < dependencyCount; ++i) {
+            const auto& dependency = dependencies[i].state;
+            if( !dependency ) continue;
+
+            std::lock_guard<std::mutex> lock(dependency->mutex);
+            if( dependency->complete ) continue;
+
+            job->blockers.fetch_add( 1, std::memory_order_relaxed );
+            dependency->waiters.push_back( job );
+        }
+
+        JobHandle handle( job->state );
+
+        // Drop the registration guard, queues the job unless a dependency is still running
+        Release( job );
+        return handle;
+    }
+
+    void Release(const JobPtr& job) {
+        if( job->blockers.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
+            Enqueue( job );
+        }
+    }
+
+    void Enqueue(JobPtr job) {
+        // Workers push to their own queue, other threads spread jobs round robin
+        int index = WorkerIndex();
+        if( index < 0 ) {
+            index = static_cast<int>( nextQueue.fetch_add( 1, std::memory_order_relaxed ) % queues.size() );
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(queues[index]->mutex);
+            queues[index]->jobs.push_back( std::move(job) );
+        }
+
+        // Touch the sleep mutex so a worker between its check and its wait cannot miss this
+        queued.fetch_add( 1, std::memory_order_release );
+        { std::lock_guard<std::mutex> lock(sleepMutex); }
+        wake.notify_one();
+    }
+
+    // Own queue first (newest job, still warm in cache), then steal the oldest job of another worker
+    JobPtr Take() {
+        const int self = WorkerIndex();
+        const size_t count = queues.size();
+
+        if( self >= 0 ) {
+            WorkerQueue& queue = *queues[self];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if( !queue.jobs.empty() ) {
+                JobPtr job = std::move( queue.jobs.back() );
+                queue.jobs.pop_back();
+                return job;
+            }
+        }
+
+        const size_t start = self >= 0 ? static_cast<size_t>( self ) + 1 : nextQueue.load( std::memory_order_relaxed );
+        for(size_t i = 0; i < count; ++i) {
+            WorkerQueue& queue = *queues[( start + i ) % count];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if( !queue.jobs.empty() ) {
+                JobPtr job = std::move( queue.jobs.front() );
+                queue.jobs.pop_front();
+                return job;
+            }
+        }
+        return nullptr;
+    }
+
+    bool RunOne() {
+        JobPtr job = Take();
+        if( !job ) return false;
+
+        queued.fetch_sub( 1, std::memory_order_relaxed );
+
+        // Keep the outer job current across nested runs (Wait inside a job)
+        auto outer = std::move( CurrentJob() );
+        CurrentJob() = job->state;
+        job->fn();
+        CurrentJob() = std::move(outer);
+
+        Finish( job->state );
+        return true;
+    }
+
+    /*
+     *  Function: Finish
+     *
+     *  Description:
+     *      Drops one unfinished count of a job. On the last one the job and everything it
+     *      spawned are done: its dependents are released, threads blocked in Wait are woken,
+     *      and the count it holds on its parent is dropped in turn.
+     *
+     *  In:
+     *      state - job whose own run or one of whose children completed
+     *
+     *  Out:
+     *      none
+     */
+    void Finish(std::shared_ptr<JobDetail::JobState> state) {
+        while( state && state->unfinished.fetch_sub( 1, std::memory_order_acq_rel ) == 1 ) {
+            std::vector<JobPtr> waiters;
+            {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->complete = true;
+                waiters.swap( state->waiters );
+            }
+            for(const JobPtr& waiter : waiters) {
+                Release( waiter );
+            }
+
+            // Pairs with the increment in Wait: either it sees the job done or we see it blocked
+            std::atomic_thread_fence( std::memory_order_seq_cst );
+            if( blockedWaiters.load( std::memory_order_relaxed ) > 0 ) {
+                { std::lock_guard<std::mutex> lock(sleepMutex); }
+                wake.notify_all();
+            }
+
+            auto parent = std::move( state->parent );
+            state = std::move( parent );
+        }
+    }
+
+    void WorkerLoop(unsigned index) {
+        WorkerIndex() = static_cast<int>( index );
+        TRAJAN_TRACE_THREAD( "Job Worker" );
+
+        while( true ) {
+            if( RunOne() ) continue;
+
+            std::unique_lock<std::mutex> lock(sleepMutex);
+            wake.wait( lock, [this] { return stopping || queued > 0; } );
+            if( stopping && queued == 0 ) return;
+        }
+    }
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> nextQueue{ 0 };
+
+    // Idle workers sleep until something is queued, blocked Wait calls until a job completes
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<size_t> queued{ 0 };
+    std::atomic<uint32_t> blockedWaiters{ 0 };
+    bool stopping = false;
+};
+
+#endif //JOB_SYSTEM_HPP
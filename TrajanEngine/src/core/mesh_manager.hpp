@@ -12,18 +12,25 @@
 
 #ifndef MESH_MANAGER_HPP
 #define MESH_MANAGER_HPP
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
 #include "i_asset_manager.hpp"
 #include "i_renderer.hpp"
+#include "log.hpp"
 #include "mesh.hpp"
 
 class MeshManager : public IAssetManagerT<Mesh> {
     struct Entry {
         std::unique_ptr<Mesh> cpu_mesh;
-        int refs = 0;
+        std::atomic<int> refs{ 0 };
     };
 
 public:
-    explicit MeshManager(IRenderer& r) : renderer(r) {};
+    // Meshes are uploaded on the thread that built the manager, the one owning the renderer
+    explicit MeshManager(IRenderer& r) : renderer(r), rendererThread(std::this_thread::get_id()) {};
 
     Handle loadQuad() {
         static const float quadVerts[] = { -0.5f,-0.5f,0,   0,0,
@@ -34,34 +41,49 @@ public:
 
         // Generate UUID for the asset
         static UUID quadID = UUID::generate();
-        auto& ent = cache[quadID];
+        if(Handle existing = loadFromGUID(quadID); existing.isValid()) return existing;
 
-        if(!ent.cpu_mesh) {
-            ent.cpu_mesh = std::make_unique<Mesh>();
-            ent.cpu_mesh->name = "Quad";
-            ent.cpu_mesh->vertexCount = 4;
-            ent.cpu_mesh->indexCount = 6;
-
-            MeshDescriptor desc;
-            desc.vertexData = quadVerts;
-            desc.vertexSize = sizeof(quadVerts);
-            desc.indexData = quadInds;
-            desc.indexSize = sizeof(quadInds);
-            desc.layout.attribs = {
-                { VertexSemantic::Position, VertexDataType::Float32, 3, false, 0 },
-                { VertexSemantic::TexCoord0, VertexDataType::Float32, 2, false, 12 }
-            };
-            desc.layout.stride = 5*sizeof(float);
-
-            ent.cpu_mesh->rendererHandle = renderer.CreateMesh(desc);
+        if(std::this_thread::get_id() != rendererThread) {
+            Log::Error("Quad mesh must first be loaded on the renderer's thread");
+            return {};
+        }
+
+        // Uploaded before taking the lock, other worlds keep copying and dropping handles meanwhile
+        auto mesh = std::make_unique<Mesh>();
+        mesh->name = "Quad";
+        mesh->vertexCount = 4;
+        mesh->indexCount = 6;
+
+        MeshDescriptor desc;
+        desc.vertexData = quadVerts;
+        desc.vertexSize = sizeof(quadVerts);
+        desc.indexData = quadInds;
+        desc.indexSize = sizeof(quadInds);
+        desc.layout.attribs = {
+            { VertexSemantic::Position, VertexDataType::Float32, 3, false, 0 },
+            { VertexSemantic::TexCoord0, VertexDataType::Float32, 2, false, 12 }
+        };
+        desc.layout.stride = 5*sizeof(float);
+
+        mesh->rendererHandle = renderer.CreateMesh(desc);
+
+        std::unique_lock lock(mutex);
+        auto& ent = cache[quadID];
+        if(ent.cpu_mesh) {
+            // Someone else uploaded it in the meantime, drop ours
+            lock.unlock();
+            if(mesh->rendererHandle) renderer.DestroyMesh(mesh->rendererHandle);
+            return loadFromGUID(quadID);
         }
 
+        ent.cpu_mesh = std::move(mesh);
         ++ent.refs;
         return Handle{ quadID, ent.cpu_mesh.get(), this, false };
     }
 
     // Asset Manager Overrides
     Handle loadFromGUID(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it == cache.end() || !it->second.cpu_mesh) return {};
         ++it->second.refs;
@@ -74,16 +96,19 @@ public:
     }
 
     void addRef(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it != cache.end()) ++it->second.refs;
     }
 
     void release(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it != cache.end()) --it->second.refs;
     }
 
     void CollectGarbage() override {
+        std::unique_lock lock(mutex);
         for(auto it = cache.begin(); it != cache.end(); ) {
             if(it->second.refs <= 0) {
                 if(it->second.cpu_mesh && it->second.cpu_mesh->rendererHandle) {
@@ -98,6 +123,7 @@ public:
     }
 
     void UnloadAll() override {
+        std::unique_lock lock(mutex);
         for(auto& [id, ent] : cache) {
             if(ent.cpu_mesh && ent.cpu_mesh->rendererHandle) {
                 renderer.DestroyMesh(ent.cpu_mesh->rendererHandle);
@@ -107,8 +133,12 @@ public:
     }
 
 private:
+    // Worlds copy and drop handles concurrently: those only read the map (refs are atomic) and share the lock,
+    // the quad insert and garbage collection take it alone
+    std::shared_mutex mutex;
     std::unordered_map<UUID, Entry, UUID::Hasher> cache;
     IRenderer& renderer;
+    std::thread::id rendererThread;
 };
 
 #endif //MESH_MANAGER_HPP
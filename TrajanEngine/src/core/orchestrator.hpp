@@ -12,21 +12,42 @@
 
 #ifndef ORCHESTRATOR_HPP
 #define ORCHESTRATOR_HPP
+#include <array>
+#include <atomic>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <vector>
 
+#include "archetype_manager.hpp"
+#include "change_tick.hpp"
+#include "command_buffer.hpp"
 #include "component_manager.hpp"
 #include "entity_manager.hpp"
+#include "event_bus.hpp"
 #include "system_manager.hpp"
+#include "trajan_engine.hpp"
+#include "view.hpp"
+
+class AssetSystem;
 
 class Orchestrator {
 public:
-    void Initialize() {
+    void Initialize(Entity maxEntities = DEFAULT_MAX_ENTITIES, StorageBackend storage = StorageBackend::SparseSet) {
+        backend = storage;
+
         // Create all managers
-        entityManager = std::make_unique<EntityManager>();
+        entityManager = std::make_unique<EntityManager>( maxEntities );
         componentManager = std::make_unique<ComponentManager>();
-        systemManager = std::make_unique<SystemManager>();
+        systemManager = std::make_unique<SystemManager>( clock );
+
+        if( backend == StorageBackend::Archetype ) {
+            archetypeManager = std::make_unique<ArchetypeManager>();
+        }
     }
 
+    [[nodiscard]] StorageBackend GetStorageBackend() const { return backend; }
+
     /*********************************
     *
     * Entity Functions:
@@ -34,14 +55,90 @@ public:
     *********************************/
 
     Entity CreateEntity() {
-        return entityManager->CreateEntity().value();
+        const Entity entity = entityManager->CreateEntity().value();
+
+        // Only systems with an empty signature match an entity without components
+        systemManager->EntitiesCreated( std::span<const Entity>( &entity, 1 ), Signature{} );
+        return entity;
     }
 
     void DestroyEntity(Entity entity) {
-        entityManager->DestroyEntity( entity );
+        if( !entityManager->IsAlive( entity ) ) {
+            Log::Warn("Tried to destroy dead entity " + std::to_string(entity));
+            return;
+        }
 
-        componentManager->EntityDestroyed( entity );
-        systemManager->EntityDestroyed( entity );
+        ReleaseEntity( entity, entityManager->GetSignature( entity ).value() );
+    }
+
+    /*
+     *  Function: CreateEntities
+     *
+     *  Description:
+     *      Spawns count entities that each get a copy of components..., allocating handles,
+     *      filling each pool and updating system membership in one pass instead of per entity.
+     *
+     *  In:
+     *      count      - number of entities to spawn
+     *      components - initial component values, one of each registered type
+     *
+     *  Out:
+     *      std::vector<Entity> - the new handles, empty if the entity limit would be exceeded
+     */
+    template<typename... Ts>
+    std::vector<Entity> CreateEntities(size_t count, const Ts&... components) {
+        const std::array<ComponentType, sizeof...(Ts)> types{ componentManager->GetComponentType<Ts>()... };
+
+        Signature signature;
+        for(ComponentType type : types) signature.set( type );
+
+        std::vector<Entity> batch;
+        if( count == 0 || !entityManager->CreateEntities( count, signature, batch ) ) {
+            return batch;
+        }
+
+        if constexpr ( sizeof...(Ts) > 0 ) {
+            if( backend == StorageBackend::Archetype ) {
+                archetypeManager->AddComponents<Ts...>( batch, signature, types, clock.Now(), components... );
+            }
+            else {
+                ( componentManager->AddComponents<Ts>( batch, components, clock.Now() ), ... );
+            }
+            Touch( signature );
+        }
+        systemManager->EntitiesCreated( batch, signature );
+        return batch;
+    }
+
+    // Destroys a batch of entities, dead or repeated handles are skipped with a warning
+    void DestroyEntities(std::span<const Entity> entities) {
+        // Kill handles first so repeats are caught, and collect which pools and systems are involved
+        Signature involved;
+        destroyed.clear();
+        for(Entity entity : entities) {
+            if( !entityManager->IsAlive( entity ) ) {
+                Log::Warn("Tried to destroy dead entity " + std::to_string(entity));
+                continue;
+            }
+
+            involved = involved | entityManager->GetSignature( entity ).value();
+            entityManager->DestroyEntity( entity );
+            destroyed.push_back( entity );
+        }
+
+        if( backend == StorageBackend::Archetype ) {
+            for(Entity entity : destroyed) archetypeManager->EntityDestroyed( entity );
+        }
+        else {
+            componentManager->EntitiesDestroyed( destroyed, involved );
+        }
+        Touch( involved );
+        systemManager->EntitiesDestroyed( destroyed, involved );
+    }
+
+    // Cheap validity check, safe to call with handles held across frames
+    [[nodiscard]] bool IsAlive(Entity entity) const {
+        return entityManager->IsAlive( entity );
     }
 
     /*********************************
@@ -52,37 +149,183 @@ public:
 
     template<typename T>
     void RegisterComponent() {
-        componentManager->RegisterComponent<T>();
+        if( backend == StorageBackend::Archetype ) {
+            // Component manager only hands out the type, archetypes own the data
+            if( !componentManager->RegisterComponentType<T>() ) return;
+            archetypeManager->RegisterComponent<T>( componentManager->GetComponentType<T>() );
+        }
+        else {
+            componentManager->RegisterComponent<T>();
+        }
         Log::Message("Component type registered: " + std::string(typeid(T).name()));
     }
 
     template<typename T>
     void AddComponent(Entity entity, T component) {
-        componentManager->AddComponent<T>( entity, component );
+        if( !entityManager->IsAlive( entity ) ) {
+            Log::Error("Tried to add component " + std::string(typeid(T).name()) + " to dead entity " + std::to_string(entity));
+            return;
+        }
+
+        if( backend == StorageBackend::Archetype ) {
+            archetypeManager->AddComponent<T>( entity, componentManager->GetComponentType<T>(), std::move(component), clock.Now() );
+        }
+        else {
+            componentManager->AddComponent<T>( entity, std::move(component), clock.Now() );
+        }
 
-        auto signature = entityManager->GetSignature( entity ).value();
+        const Signature previous = entityManager->GetSignature( entity ).value();
+        Signature signature = previous;
         signature.set( componentManager->GetComponentType<T>(), true );
         entityManager->SetSignature( entity, signature );
+        Touch( componentManager->GetComponentType<T>() );
 
-        systemManager->EntitySignatureChanged( entity, signature );
+        systemManager->EntitySignatureChanged( entity, previous, signature );
     }
 
     template<typename T>
     void RemoveComponent(Entity entity) {
-        componentManager->RemoveComponent<T>( entity );
+        if( !entityManager->IsAlive( entity ) ) {
+            Log::Error("Tried to remove component " + std::string(typeid(T).name()) + " from dead entity " + std::to_string(entity));
+            return;
+        }
 
-        auto signature = entityManager->GetSignature( entity ).value();
+        if( backend == StorageBackend::Archetype ) {
+            archetypeManager->RemoveComponent( entity, componentManager->GetComponentType<T>(), typeid(T).name() );
+        }
+        else {
+            componentManager->RemoveComponent<T>( entity );
+        }
+
+        const Signature previous = entityManager->GetSignature( entity ).value();
+        Signature signature = previous;
         signature.set( componentManager->GetComponentType<T>(), false );
         entityManager->SetSignature( entity, signature );
+        Touch( componentManager->GetComponentType<T>() );
 
-        systemManager->EntitySignatureChanged( entity, signature );
+        systemManager->EntitySignatureChanged( entity, previous, signature );
     }
 
+    // GetComponent<T> marks the component changed, GetComponent<const T> is a read-only access
     template<typename T>
     T& GetComponent(Entity entity) {
-        return componentManager->GetComponent<T>( entity );
+        using Component = std::remove_const_t<T>;
+
+        Component* ptr = nullptr;
+        if( backend == StorageBackend::Archetype ) {
+            ptr = archetypeManager->GetComponent<Component>( entity, componentManager->GetComponentType<Component>() );
+            if( !ptr ) {
+                Log::Assert(false, "Component not found on entity");
+            }
+        }
+        else {
+            ptr = &componentManager->GetComponent<Component>( entity );
+        }
+
+        if constexpr ( !std::is_const_v<T> ) {
+            MarkChanged<Component>( entity );
+        }
+        return *ptr;
+    }
+
+    // Explicitly flags a component as changed, for writes made through a reference obtained earlier
+    template<typename T>
+    void MarkChanged(Entity entity) {
+        if( ComponentTicks* ticks = GetTicks<T>( entity ) ) {
+            ticks->changed = clock.Now();
+            Touch( componentManager->GetComponentType<std::remove_const_t<T>>() );
+        }
+    }
+
+    // True if any T may have been added, changed or removed since the calling system's last run, in O(1)
+    // Conservative: mutable Views, GetComponent<T> and GetComponentArray<T> count as writes to every T.
+    template<typename T>
+    [[nodiscard]] bool AnyChanged() const {
+        const ComponentType type = componentManager->GetComponentType<std::remove_const_t<T>>();
+        return IsNewer( writeTicks[type].load( std::memory_order_relaxed ), ChangeClock::ThreadSince() );
+    }
+
+    // Added/changed ticks of a component, nullptr if the entity does not own it
+    template<typename T>
+    ComponentTicks* GetTicks(Entity entity) {
+        using Component = std::remove_const_t<T>;
+        if( backend == StorageBackend::Archetype ) {
+            return archetypeManager->GetTicks( entity, componentManager->GetComponentType<Component>() );
+        }
+
+        auto* array = componentManager->GetComponentArray<Component>();
+        return array ? array->GetTicks( entity ) : nullptr;
+    }
+
+    // True if a living entity owns a T, read from its signature without touching the pools
+    template<typename T>
+    [[nodiscard]] bool HasComponent(Entity entity) {
+        if( !entityManager->IsAlive( entity ) ) return false;
+        return entityManager->GetSignature( entity )->test( componentManager->GetComponentType<std::remove_const_t<T>>() );
+    }
+
+    /*
+     *  Function: CreateGroup
+     *
+     *  Description:
+     *      Declares Ts... as components that are iterated together. Their pools are kept packed
+     *      and in the same order as entities enter and leave the group, so a View over them
+     *      (or over a superset of them) walks parallel arrays instead of looking entities up.
+     *      Archetype storage already co-locates components, the call is ignored there.
+     *
+     *  In:
+     *      none
+     *
+     *  Out:
+     *      bool - true if the group exists afterwards
+     */
+    template<typename... Ts>
+    bool CreateGroup() {
+        if( backend == StorageBackend::Archetype ) {
+            Log::Warn("Groups only apply to sparse set storage, archetypes already keep components together");
+            return false;
+        }
+
+        return componentManager->CreateGroup<Ts...>() != nullptr;
     }
 
+    // Owning group over exactly Ts..., nullptr if there is none (always with archetype storage)
+    template<typename... Ts>
+    [[nodiscard]] Group* GetGroup() {
+        if( backend == StorageBackend::Archetype ) return nullptr;
+
+        const std::array<ComponentType, sizeof...(Ts)> types{ componentManager->GetComponentType<Ts>()... };
+        Signature signature;
+        for(ComponentType type : types) {
+            signature.set( type );
+        }
+
+        Group* group = componentManager->GetGroup( types[0] );
+        return group && group->Types() == signature ? group : nullptr;
+    }
+
+    // Pool of T for dense access (index-aligned with a group it belongs to), nullptr with archetype storage
+    // Writes through it bypass change detection, stamp the ticks by hand.
+    template<typename T>
+    [[nodiscard]] ComponentArray<T>* GetComponentArray() {
+        if( backend == StorageBackend::Archetype ) return nullptr;
+        Touch( componentManager->GetComponentType<T>() );
+        return componentManager->GetComponentArray<T>();
+    }
+
+    // Typed iteration over every entity owning all of Ts..., e.g. View<const Transform2D, const Sprite>().Each(fn)
+    // ParallelEach runs on the job system given to SetJobSystem
+    // Changed<T>/Added<T> filters compare against the calling system's last run
+    template<typename... Ts>
+    ComponentView<Ts...> View() {
+        ( ( std::is_const_v<Ts> ? void() : Touch( componentManager->GetComponentType<std::remove_const_t<Ts>>() ) ), ... );
+        return ComponentView<Ts...>( backend, *componentManager, archetypeManager.get(), jobSystem,
+                                     clock.Now(), ChangeClock::ThreadSince() );
+    }
+
+    // Current change tick
+    [[nodiscard]] Tick GetTick() const { return clock.Now(); }
+
     template<typename T>
     ComponentType GetComponentType() {
         return componentManager->GetComponentType<T>();
@@ -104,12 +347,45 @@ public:
         systemManager->SetSignature<T>(signature);
     }
 
+    // Parallel scheduling requires structural changes from systems to go through GetCommandBuffer()
+    // and a job system to run on (see SetJobSystem)
+    void SetSystemScheduling(SystemScheduling mode) {
+        systemManager->SetScheduling( mode, jobSystem );
+    }
+
+    [[nodiscard]] SystemScheduling GetSystemScheduling() const { return systemManager->GetScheduling(); }
+
+    // Per-system min/avg/p99 over recent updates, empty unless built with TRAJAN_PROFILE_SYSTEMS
+    [[nodiscard]] std::vector<SystemTimings> GetSystemTimings() const { return systemManager->GetSystemTimings(); }
+    void ResetSystemTimings() { systemManager->ResetSystemTimings(); }
+
+    // True if any system must be updated on the thread calling UpdateSystems
+    [[nodiscard]] bool HasMainThreadSystems() const { return systemManager->HasMainThreadSystems(); }
+
+    // Workers shared with the rest of the engine, not owned
+    void SetJobSystem(JobSystem* jobs) { jobSystem = jobs; }
+    [[nodiscard]] JobSystem* GetJobSystem() const { return jobSystem; }
+
     void InitializeSystems(const SystemContext& ctx) {
         systemManager->InitializeSystems( ctx );
     }
 
     void UpdateSystems(float dt) {
         systemManager->UpdateSystems( dt );
+
+        // Writes from here until the next update are newer than every system's last run
+        clock.Advance();
+
+        // Sync point: structural changes recorded by systems land before the next frame
+        FlushCommands();
+
+        // Events published this frame become readable next frame
+        events.Swap();
+    }
+
+    // Render pass of every system, once per displayed frame (see System::Render)
+    void RenderSystems(float alpha) {
+        systemManager->RenderSystems( alpha );
     }
 
     void ShutdownSystems() {
@@ -117,26 +393,307 @@ public:
     }
 
     // Helper function for registering systems
+    // Component types double as the access declaration: const T is read-only, T is read-write
     template <typename SystemType, typename... ComponentTypes>
     void CreateSystem() {
         // Register the system to the orchestrator
         auto system = RegisterSystem<SystemType>();
+        if( !system ) return;
 
         // Create signature
         Signature signature;
-        (signature.set(GetComponentType<ComponentTypes>()), ...);
+        (signature.set(GetComponentType<std::remove_const_t<ComponentTypes>>()), ...);
 
         // Set the signature in the system
         SetSystemSignature<SystemType>(signature);
 
+        // Split into reads and writes for the scheduler
+        Signature reads;
+        Signature writes;
+        ( ( std::is_const_v<ComponentTypes> ? reads : writes ).set( GetComponentType<std::remove_const_t<ComponentTypes>>() ), ... );
+        systemManager->SetAccess<SystemType>( reads, writes );
+
         Log::Message("Registered system: " + std::string(typeid(SystemType).name()));
     }
 
+    // Declares access a system needs beyond its signature, e.g. optional components it looks up
+    // const T is read-only, T is read-write
+    template <typename SystemType, typename... ComponentTypes>
+    void DeclareSystemAccess() {
+        Signature reads;
+        Signature writes;
+        ( ( std::is_const_v<ComponentTypes> ? reads : writes ).set( GetComponentType<std::remove_const_t<ComponentTypes>>() ), ... );
+        systemManager->AddAccess<SystemType>( reads, writes );
+    }
+
+    // Archetype storage, only present with StorageBackend::Archetype
+    [[nodiscard]] ArchetypeManager* GetArchetypeManager() const { return archetypeManager.get(); }
+
+    /*********************************
+    *
+    * Events:
+    *
+    *********************************/
+
+    // Event types must be registered before anything publishes them, capacity is per frame and grows on overflow
+    template<typename T>
+    void RegisterEvent(uint32_t capacity = DEFAULT_EVENT_CAPACITY) {
+        events.RegisterEvent<T>( capacity );
+    }
+
+    // Lock-free, safe from parallel systems and jobs. Readable next frame.
+    template<typename T>
+    bool PublishEvent(const T& event) {
+        return events.Publish( event );
+    }
+
+    // Events of type T published during the previous frame
+    template<typename T>
+    [[nodiscard]] std::span<const T> ReadEvents() const {
+        return events.Read<T>();
+    }
+
+    [[nodiscard]] EventBus& GetEventBus() { return events; }
+
+    /*********************************
+    *
+    * Deferred Commands:
+    *
+    *********************************/
+
+    // Buffer systems record structural changes into while iterating
+    [[nodiscard]] CommandBuffer& GetCommandBuffer() { return commands; }
+
+    /*
+     *  Function: FlushCommands
+     *
+     *  Description:
+     *      Plays back the command buffer in recording order. Storage and signatures are updated
+     *      per command, but systems are only re-matched once per touched entity at the end,
+     *      against the first signature they saw this flush.
+     *
+     *  In:
+     *      none
+     *
+     *  Out:
+     *      none
+     */
+    void FlushCommands() {
+        if( commands.Empty() ) return;
+
+        created.clear();
+        for(CommandBuffer::Command& command : commands.Commands()) {
+            if( command.op == CommandBuffer::Op::Create ) {
+                const auto entity = entityManager->CreateEntity();
+                if( !entity ) {
+                    Log::Error("Deferred entity creation failed, entity limit reached");
+                }
+                else {
+                    systemManager->EntitiesCreated( std::span<const Entity>( &*entity, 1 ), Signature{} );
+                }
+                created.push_back( entity.value_or( NULL_ENTITY ) );
+                continue;
+            }
+
+            const Entity entity = command.pending == CommandBuffer::NO_PENDING ? command.entity : created[command.pending];
+            if( !entityManager->IsAlive( entity ) ) {
+                Log::Warn("Skipped deferred command on dead entity " + std::to_string(entity));
+                continue;
+            }
+
+            switch( command.op ) {
+                case CommandBuffer::Op::Destroy: {
+                    // Systems still hold the entity under the signature they last matched
+                    Signature membership = entityManager->GetSignature( entity ).value();
+                    const uint32_t index = dirty.Find( entity );
+                    if( index != SparseSet::INVALID_INDEX ) {
+                        membership = dirtyPrevious[index];
+                        dirty.Remove( entity );
+                        dirtyPrevious[index] = dirtyPrevious.back();
+                        dirtyPrevious.pop_back();
+                    }
+                    ReleaseEntity( entity, membership );
+                    break;
+                }
+                case CommandBuffer::Op::Add: {
+                    if( !componentManager->IsRegistered( command.type ) ) {
+                        Log::Error("Deferred add of unregistered component " + std::string(command.info->name));
+                        break;
+                    }
+
+                    const bool added = backend == StorageBackend::Archetype
+                        ? archetypeManager->AddComponentRelocated( entity, command.type, command.payload, clock.Now() )
+                        : componentManager->AddComponentRelocated( entity, command.type, command.payload, clock.Now() );
+                    if( !added ) break;
+
+                    // Payload now lives in storage
+                    command.info = nullptr;
+                    StageSignature( entity, command.type, true );
+                    break;
+                }
+                case CommandBuffer::Op::Remove: {
+                    if( !componentManager->IsRegistered( command.type ) ) {
+                        Log::Error("Deferred remove of unregistered component " + std::string(command.info->name));
+                        break;
+                    }
+
+                    if( backend == StorageBackend::Archetype ) {
+                        archetypeManager->RemoveComponent( entity, command.type, command.info->name );
+                    }
+                    else {
+                        componentManager->RemoveComponent( entity, command.type );
+                    }
+                    StageSignature( entity, command.type, false );
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+
+        // One re-match per touched entity, however many components it gained or lost
+        for(size_t i = 0; i < dirty.Size(); ++i) {
+            const Entity entity = dirty[i];
+            systemManager->EntitySignatureChanged( entity, dirtyPrevious[i], entityManager->GetSignature( entity ).value() );
+        }
+        dirty.Clear();
+        dirtyPrevious.clear();
+
+        commands.Clear();
+    }
+
+    /*********************************
+    *
+    * Snapshots:
+    *
+    *********************************/
+
+    // Serializes the entity slot table and every component pool, sparse set storage only
+    // Returns the snapshot, empty on failure
+    [[nodiscard]] TRAJANENGINE_API std::vector<uint8_t> SaveSnapshot() const;
+
+    /*
+     *  Function: LoadSnapshot
+     *
+     *  Description:
+     *      Replaces the world with a snapshot, e.g. loading a save game or a play-in-editor copy.
+     *      Entity handles come back exactly as saved. Restored components count as added at the
+     *      current tick, and systems are re-matched against the restored signatures.
+     *      Must not be called while systems are updating; pending commands are dropped.
+     *
+     *  In:
+     *      bytes  - snapshot made by SaveSnapshot
+     *      assets - resolves AssetHandle UUIDs, nullptr leaves asset handles empty
+     *
+     *  Out:
+     *      bool - false if the snapshot is invalid, the world is left empty in that case
+     */
+    TRAJANENGINE_API bool LoadSnapshot(std::span<const uint8_t> bytes, AssetSystem* assets = nullptr);
+
 private:
+    // Drops every entity and component at once, systems are told first
+    void ClearWorld() {
+        Signature involved;
+        destroyed.clear();
+        entityManager->LivingEntities( destroyed );
+        for(Entity entity : destroyed) {
+            involved = involved | entityManager->GetSignature( entity ).value();
+        }
+        Touch( involved );
+        systemManager->EntitiesDestroyed( destroyed, involved );
+
+        componentManager->Clear();
+        entityManager = std::make_unique<EntityManager>( entityManager->MaxEntities() );
+
+        // Pending events may name entities from the old world
+        events.Clear();
+    }
+
+    // Sets signature bits from pool membership, fails if a pool holds an entity that is not alive
+    bool RebuildSignatures() {
+        for(ComponentType type = 0; type < MAX_COMPONENTS; ++type) {
+            IComponentArray* array = componentManager->GetComponentArray( type );
+            if( !array ) continue;
+
+            if( !array->Entities().Empty() ) Touch( type );
+            for(Entity entity : array->Entities()) {
+                if( !entityManager->IsAlive( entity ) ) return false;
+
+                Signature signature = entityManager->GetSignature( entity ).value();
+                signature.set( type );
+                entityManager->SetSignature( entity, signature );
+            }
+        }
+        return true;
+    }
+
+    // Tears down a living entity, membership is the signature systems currently match it under
+    void ReleaseEntity(Entity entity, const Signature& membership) {
+        Touch( entityManager->GetSignature( entity ).value() );
+        entityManager->DestroyEntity( entity );
+
+        if( backend == StorageBackend::Archetype ) {
+            archetypeManager->EntityDestroyed( entity );
+        }
+        else {
+            componentManager->EntityDestroyed( entity );
+        }
+        systemManager->EntityDestroyed( entity, membership );
+    }
+
+    // Flips one signature bit during playback, remembering the signature systems last saw
+    void StageSignature(Entity entity, ComponentType type, bool value) {
+        Signature signature = entityManager->GetSignature( entity ).value();
+        if( !dirty.Contains( entity ) ) {
+            dirty.Insert( entity );
+            dirtyPrevious.push_back( signature );
+        }
+
+        signature.set( type, value );
+        entityManager->SetSignature( entity, signature );
+        Touch( type );
+    }
+
+    // Stamps the pools' write ticks read by AnyChanged
+    // Checked first so threads writing the same type in one step do not keep taking the cache line from each other
+    void Touch(ComponentType type) {
+        const Tick now = clock.Now();
+        if( writeTicks[type].load( std::memory_order_relaxed ) != now ) {
+            writeTicks[type].store( now, std::memory_order_relaxed );
+        }
+    }
+
+    void Touch(const Signature& types) {
+        types.ForEach([this](size_t type) { Touch( static_cast<ComponentType>( type ) ); });
+    }
+
+    StorageBackend backend = StorageBackend::SparseSet;
+
+    // Change detection clock, shared with the system manager
+    ChangeClock clock;
+
+    // Per component type: last tick any of its components was written, added or removed
+    std::array<std::atomic<Tick>, MAX_COMPONENTS> writeTicks{};
+
     std::unique_ptr<EntityManager> entityManager;
     std::unique_ptr<ComponentManager> componentManager;
+    std::unique_ptr<ArchetypeManager> archetypeManager;
     std::unique_ptr<SystemManager> systemManager;
-    // TODO: event bus
+
+    // Frame-delayed events between systems
+    EventBus events;
+
+    CommandBuffer commands;
+
+    JobSystem* jobSystem = nullptr;
+
+    // Handles that passed validation in DestroyEntities, also snapshot scratch
+    std::vector<Entity> destroyed;
+
+    // Playback scratch: entities made by this flush, and entities awaiting a re-match with their pre-flush signature
+    std::vector<Entity> created;
+    SparseSet dirty;
+    std::vector<Signature> dirtyPrevious;
 };
 
 #endif //ORCHESTRATOR_HPP
@@ -19,6 +19,7 @@
 #include <SPIRV/GlslangToSpv.h>
 
 #include "log.hpp"
+#include "trace.hpp"
 #include "glslang/Public/resource_limits_c.h"
 
 namespace {
@@ -158,6 +159,8 @@ namespace {
 }
 
 std::optional<std::vector<uint32_t>> CompileGLSLtoSPIRV(const std::string& source, ShaderStage stage) {
+    TRAJAN_TRACE_ZONE( "CompileGLSLtoSPIRV" );
+
     static bool initialized = false;
     if (!initialized) {
         glslang::InitializeProcess();
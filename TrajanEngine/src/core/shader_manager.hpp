@@ -12,35 +12,53 @@
 
 #ifndef SHADER_MANAGER_HPP
 #define SHADER_MANAGER_HPP
+#include <atomic>
 #include <fstream>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <thread>
 
 #include "i_asset_manager.hpp"
 #include "i_renderer.hpp"
+#include "log.hpp"
 #include "shader.hpp"
 
 class ShaderManager : public IAssetManagerT<Shader> {
     struct Entry {
         std::unique_ptr<Shader> shader;
-        int refs = 0;
+        std::atomic<int> refs{ 0 };
     };
 
 public:
-    explicit ShaderManager(IRenderer& r) : renderer(r) {};
+    // Built on the thread owning the renderer, the only one allowed to compile shaders
+    explicit ShaderManager(IRenderer& r) : renderer(r), rendererThread(std::this_thread::get_id()) {};
 
     // TODO: consider implementing dedupe built in to manager
     Handle getOrCreate(const std::string& key, const ShaderDescriptor& desc) {
-        auto it = byKey.find(key);
-        if(it != byKey.end()) {
-            return loadFromGUID(it->second);
+        if(Handle existing = findByKey(key); existing.isValid()) return existing;
+
+        if(std::this_thread::get_id() != rendererThread) {
+            Log::Error("Shader " + key + " must be created on the renderer's thread");
+            return {};
+        }
+
+        // Compiled without the lock, so handle traffic from other worlds is not held up by it
+        auto shader = std::make_unique<Shader>();
+        shader->name = key.empty() ? "Shader" : key;
+        shader->rendererHandle = renderer.CreateShader(desc);
+
+        std::unique_lock lock(mutex);
+        if(auto it = byKey.find(key); it != byKey.end()) {
+            // Lost a race to another creator, keep theirs
+            lock.unlock();
+            if(shader->rendererHandle) renderer.DestroyShader(shader->rendererHandle);
+            return findByKey(key);
         }
 
-        // create new shader resource
         UUID id = UUID::generate();
         auto& ent = cache[id];
-        ent.shader = std::make_unique<Shader>();
-        ent.shader->name = key.empty() ? "Shader" : key;
-        ent.shader->rendererHandle = renderer.CreateShader(desc);
+        ent.shader = std::move(shader);
         ent.refs = 1;
 
         byKey[key] = id;
@@ -65,6 +83,7 @@ public:
     }
 
     Handle loadFromGUID(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it == cache.end() || !it->second.shader) return {};
         ++it->second.refs;
@@ -72,16 +91,19 @@ public:
     }
 
     void addRef(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it != cache.end()) ++it->second.refs;
     }
 
     void release(UUID id) override {
+        std::shared_lock lock(mutex);
         auto it = cache.find(id);
         if(it != cache.end()) --it->second.refs;
     }
 
     void CollectGarbage() override {
+        std::unique_lock lock(mutex);
         for(auto it = cache.begin(); it != cache.end();) {
             if(it->second.refs <= 0) {
                 if(it->second.shader && it->second.shader->rendererHandle) {
@@ -101,6 +123,7 @@ public:
     }
 
     void UnloadAll() override {
+        std::unique_lock lock(mutex);
         for(auto& [id, ent] : cache) {
             if(ent.shader && ent.shader->rendererHandle) {
                 renderer.DestroyShader(ent.shader->rendererHandle);
@@ -111,6 +134,18 @@ public:
     }
 
 private:
+    // Handle to the shader created under key, empty if there is none
+    Handle findByKey(const std::string& key) {
+        std::shared_lock lock(mutex);
+        auto it = byKey.find(key);
+        if(it == byKey.end()) return {};
+
+        auto existing = cache.find(it->second);
+        if(existing == cache.end() || !existing->second.shader) return {};
+        ++existing->second.refs;
+        return Handle{ it->second, existing->second.shader.get(), this, false };
+    }
+
     static std::optional<std::string> readSource(const std::string& path) {
         std::ifstream file(path, std::ios::binary);
         if(!file) return std::nullopt;
@@ -120,9 +155,12 @@ private:
     }
 
 private:
+    // Shared by lookups and ref counting (hence the atomic refs), exclusive while cache or byKey is edited
+    std::shared_mutex mutex;
     std::unordered_map<UUID, Entry, UUID::Hasher> cache;
     std::unordered_map<std::string, UUID> byKey; // caller-provided key -> UUID
     IRenderer& renderer;
+    std::thread::id rendererThread;
 };
 
 #endif //SHADER_MANAGER_HPP
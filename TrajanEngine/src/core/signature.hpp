@@ -0,0 +1,173 @@
+/*
+* File: signature.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef SIGNATURE_HPP
+#define SIGNATURE_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Pick the widest subset test the target supports
+#if defined(__AVX__)
+    #define TRAJAN_SIGNATURE_AVX
+    #include <immintrin.h>
+#elif defined(__SSE4_1__)
+    #define TRAJAN_SIGNATURE_SSE41
+    #include <smmintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+    #define TRAJAN_SIGNATURE_SSE2
+    #include <emmintrin.h>
+#endif
+
+// Fixed-width bitset of component types
+// Mirrors the std::bitset calls the ECS used (set/reset/test/none), and adds a vectorized subset test.
+template<size_t Bits>
+class WideSignature {
+    static_assert(Bits % 256 == 0, "Signature width must be a multiple of 256 bits");
+
+public:
+    static constexpr size_t WORDS = Bits / 64;
+
+    WideSignature& set(size_t bit, bool value = true) {
+        const uint64_t mask = uint64_t{1} << (bit % 64);
+        words[bit / 64] = value ? (words[bit / 64] | mask) : (words[bit / 64] & ~mask);
+        return *this;
+    }
+
+    WideSignature& reset(size_t bit) { return set( bit, false ); }
+
+    WideSignature& reset() {
+        words.fill( 0 );
+        return *this;
+    }
+
+    [[nodiscard]] bool test(size_t bit) const {
+        return ( words[bit / 64] >> (bit % 64) ) & 1;
+    }
+
+    [[nodiscard]] bool none() const {
+        uint64_t any = 0;
+        for(uint64_t word : words) any |= word;
+        return any == 0;
+    }
+
+    [[nodiscard]] bool any() const { return !none(); }
+
+    [[nodiscard]] size_t count() const {
+        size_t total = 0;
+        for(uint64_t word : words) total += std::popcount( word );
+        return total;
+    }
+
+    /*
+     *  Function: Contains
+     *
+     *  Description:
+     *      Subset test, true if every bit set in other is also set here.
+     *      Equivalent to (*this & other) == other without building a temporary.
+     *
+     *  In:
+     *      other - the signature that must be covered
+     *
+     *  Out:
+     *      bool - other is a subset of this signature
+     */
+    [[nodiscard]] bool Contains(const WideSignature& other) const {
+#if defined(TRAJAN_SIGNATURE_AVX)
+        for(size_t i = 0; i < WORDS; i += 4) {
+            const __m256i self = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( &words[i] ) );
+            const __m256i need = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( &other.words[i] ) );
+            if( !_mm256_testc_si256( self, need ) ) return false;
+        }
+        return true;
+#elif defined(TRAJAN_SIGNATURE_SSE41)
+        for(size_t i = 0; i < WORDS; i += 2) {
+            const __m128i self = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &words[i] ) );
+            const __m128i need = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &other.words[i] ) );
+            if( !_mm_testc_si128( self, need ) ) return false;
+        }
+        return true;
+#elif defined(TRAJAN_SIGNATURE_SSE2)
+        for(size_t i = 0; i < WORDS; i += 2) {
+            const __m128i self = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &words[i] ) );
+            const __m128i need = _mm_loadu_si128( reinterpret_cast<const __m128i*>( &other.words[i] ) );
+            // Bits needed but missing, must all be zero
+            const __m128i missing = _mm_andnot_si128( self, need );
+            if( _mm_movemask_epi8( _mm_cmpeq_epi8( missing, _mm_setzero_si128() ) ) != 0xFFFF ) return false;
+        }
+        return true;
+#else
+        uint64_t missing = 0;
+        for(size_t i = 0; i < WORDS; ++i) missing |= other.words[i] & ~words[i];
+        return missing == 0;
+#endif
+    }
+
+    // True if the two signatures share at least one bit
+    [[nodiscard]] bool Intersects(const WideSignature& other) const {
+        uint64_t shared = 0;
+        for(size_t i = 0; i < WORDS; ++i) shared |= words[i] & other.words[i];
+        return shared != 0;
+    }
+
+    // Calls fn(size_t bit) for every set bit, in ascending order
+    template<typename Fn>
+    void ForEach(Fn&& fn) const {
+        for(size_t i = 0; i < WORDS; ++i) {
+            uint64_t word = words[i];
+            while( word ) {
+                fn( i * 64 + std::countr_zero( word ) );
+                word &= word - 1;
+            }
+        }
+    }
+
+    friend WideSignature operator&(const WideSignature& lhs, const WideSignature& rhs) {
+        WideSignature result;
+        for(size_t i = 0; i < WORDS; ++i) result.words[i] = lhs.words[i] & rhs.words[i];
+        return result;
+    }
+
+    friend WideSignature operator|(const WideSignature& lhs, const WideSignature& rhs) {
+        WideSignature result;
+        for(size_t i = 0; i < WORDS; ++i) result.words[i] = lhs.words[i] | rhs.words[i];
+        return result;
+    }
+
+    friend WideSignature operator^(const WideSignature& lhs, const WideSignature& rhs) {
+        WideSignature result;
+        for(size_t i = 0; i < WORDS; ++i) result.words[i] = lhs.words[i] ^ rhs.words[i];
+        return result;
+    }
+
+    friend bool operator==(const WideSignature& lhs, const WideSignature& rhs) { return lhs.words == rhs.words; }
+    friend bool operator!=(const WideSignature& lhs, const WideSignature& rhs) { return !(lhs == rhs); }
+
+    struct Hasher {
+        std::size_t operator()(const WideSignature& signature) const noexcept {
+            // Simple 64-bit hash combine over every word
+            uint64_t h = 0;
+            for(uint64_t word : signature.words) {
+                h ^= word + 0x9e3779b97f4a7c13 + (h << 6) + (h >> 2);
+            }
+            return std::hash<uint64_t>{}(h);
+        }
+    };
+
+private:
+    std::array<uint64_t, WORDS> words{};
+};
+
+#endif //SIGNATURE_HPP
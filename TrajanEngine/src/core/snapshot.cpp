@@ -0,0 +1,248 @@
+/*
+* File: snapshot.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "snapshot.hpp"
+
+#include <fstream>
+
+#include "component_manager.hpp"
+#include "entity_manager.hpp"
+#include "log.hpp"
+#include "orchestrator.hpp"
+#include "snapshot_assets.hpp"
+#include "sprite.hpp"
+
+/*********************************
+*
+* Files:
+*
+*********************************/
+
+bool WriteSnapshotFile(const std::string& path, std::span<const uint8_t> bytes) {
+    std::ofstream file( path, std::ios::binary | std::ios::trunc );
+    if( !file ) {
+        Log::Error("Could not open snapshot file " + path + " for writing");
+        return false;
+    }
+
+    file.write( reinterpret_cast<const char*>( bytes.data() ), static_cast<std::streamsize>( bytes.size() ) );
+    return static_cast<bool>( file );
+}
+
+std::optional<std::vector<uint8_t>> ReadSnapshotFile(const std::string& path) {
+    std::ifstream file( path, std::ios::binary | std::ios::ate );
+    if( !file ) {
+        Log::Error("Could not open snapshot file " + path);
+        return std::nullopt;
+    }
+
+    std::vector<uint8_t> bytes( static_cast<size_t>( file.tellg() ) );
+    file.seekg( 0 );
+    file.read( reinterpret_cast<char*>( bytes.data() ), static_cast<std::streamsize>( bytes.size() ) );
+    if( !file ) {
+        Log::Error("Could not read snapshot file " + path);
+        return std::nullopt;
+    }
+    return bytes;
+}
+
+/*********************************
+*
+* World:
+*
+*********************************/
+
+/*
+ *  Function: SaveSnapshot
+ *
+ *  Description:
+ *      Serializes the entity slot table and every component pool. Trivially copyable
+ *      components are copied in bulk, others go through their ComponentSerializer.
+ *      Only supported with sparse set storage.
+ *
+ *  In:
+ *      none
+ *
+ *  Out:
+ *      std::vector<uint8_t> - the snapshot, empty on failure
+ */
+std::vector<uint8_t> Orchestrator::SaveSnapshot() const {
+    if( backend == StorageBackend::Archetype ) {
+        Log::Error("World snapshots require sparse set storage");
+        return {};
+    }
+
+    SnapshotWriter out;
+    out.Write( SNAPSHOT_MAGIC );
+    out.Write( SNAPSHOT_VERSION );
+    entityManager->Save( out );
+    componentManager->Save( out );
+    return std::move( out.Bytes() );
+}
+
+bool Orchestrator::LoadSnapshot(std::span<const uint8_t> bytes, AssetSystem* assets) {
+    if( backend == StorageBackend::Archetype ) {
+        Log::Error("World snapshots require sparse set storage");
+        return false;
+    }
+
+    SnapshotReader in( bytes, assets );
+    uint32_t magic = 0;
+    uint32_t version = 0;
+    if( !in.Read( magic ) || !in.Read( version ) || magic != SNAPSHOT_MAGIC || version != SNAPSHOT_VERSION ) {
+        Log::Error("Data is not a world snapshot, or one from an incompatible version");
+        return false;
+    }
+
+    if( !commands.Empty() ) {
+        Log::Warn("Pending commands dropped by snapshot load");
+        commands.Clear();
+    }
+
+    ClearWorld();
+    if( !entityManager->Load( in ) || !componentManager->Load( in, clock.Now() ) || !RebuildSignatures() ) {
+        Log::Error("World snapshot is malformed, world left empty");
+        ClearWorld();
+        return false;
+    }
+
+    destroyed.clear();
+    entityManager->LivingEntities( destroyed );
+    for(Entity entity : destroyed) {
+        systemManager->EntitySignatureChanged( entity, Signature{}, entityManager->GetSignature( entity ).value() );
+    }
+    return true;
+}
+
+void EntityManager::Save(SnapshotWriter& out) const {
+    out.Write( static_cast<uint32_t>( slots.size() ) );
+    out.WriteArray( slots.data(), slots.size() );
+    out.Write( freeHead );
+    out.Write( livingEntities );
+}
+
+bool EntityManager::Load(SnapshotReader& in) {
+    uint32_t count = 0;
+    if( !in.Read( count ) || count > ENTITY_INDEX_MASK || count > in.Remaining() / sizeof(Entity) ) return false;
+
+    std::vector<Entity> loaded( count );
+    uint32_t head = 0;
+    uint32_t living = 0;
+    if( !in.ReadArray( loaded.data(), count ) || !in.Read( head ) || !in.Read( living ) ) return false;
+
+    if( living > maxEntities ) {
+        Log::Error("Snapshot holds " + std::to_string(living) + " entities, more than the limit of " + std::to_string(maxEntities));
+        return false;
+    }
+
+    // The free list must visit only free slots, and all of them
+    size_t free = 0;
+    for(uint32_t index = head; index != ENTITY_INDEX_MASK; index = EntityIndex( loaded[index] )) {
+        if( index >= count || EntityIndex( loaded[index] ) == index || loaded[index] == RETIRED_SLOT || ++free > count ) return false;
+    }
+    const auto retired = static_cast<uint32_t>( std::count( loaded.begin(), loaded.end(), RETIRED_SLOT ) );
+    if( free + living + retired != count ) return false;
+
+    slots = std::move(loaded);
+    signatures.assign( slots.size(), Signature{} );
+    freeHead = head;
+    livingEntities = living;
+    retiredSlots = retired;
+    return true;
+}
+
+/*
+ *  Function: Save
+ *
+ *  Description:
+ *      Writes every serializable pool as name, element size, byte length and contents.
+ *      Pools of components that are neither trivially copyable nor have a ComponentSerializer
+ *      are left out with a warning.
+ *
+ *  In:
+ *      out - snapshot being written
+ *
+ *  Out:
+ *      none
+ */
+void ComponentManager::Save(SnapshotWriter& out) const {
+    const size_t countAt = out.Reserve<uint32_t>();
+    uint32_t count = 0;
+
+    for(auto const& array : ownedArrays) {
+        const ComponentInfo& info = array->Info();
+        if( !array->Serializable() ) {
+            Log::Warn("Component " + std::string(info.name) + " has no serializer and is not trivially copyable, left out of snapshot");
+            continue;
+        }
+
+        out.WriteString( info.name );
+        out.Write( static_cast<uint32_t>( info.size ) );
+
+        const size_t lengthAt = out.Reserve<uint64_t>();
+        const size_t start = out.Size();
+        array->Save( out );
+        out.Patch( lengthAt, static_cast<uint64_t>( out.Size() - start ) );
+        ++count;
+    }
+
+    out.Patch( countAt, count );
+}
+
+bool ComponentManager::Load(SnapshotReader& in, Tick tick) {
+    uint32_t count = 0;
+    if( !in.Read( count ) ) return false;
+
+    for(uint32_t i = 0; i < count; ++i) {
+        std::string name;
+        uint32_t size = 0;
+        uint64_t length = 0;
+        if( !in.ReadString( name ) || !in.Read( size ) || !in.Read( length ) || length > in.Remaining() ) {
+            return false;
+        }
+
+        IComponentArray* array = FindArray( name );
+        if( !array || array->Info().size != size ) {
+            Log::Warn("Snapshot pool " + name + " has no matching component, skipped");
+            in.Skip( static_cast<size_t>( length ) );
+            continue;
+        }
+
+        const size_t before = in.Remaining();
+        if( !array->Load( in, tick ) || before - in.Remaining() != length ) {
+            Log::Error("Snapshot pool " + name + " is malformed");
+            return false;
+        }
+    }
+
+    for(auto const& group : groups) {
+        group->Rebuild();
+    }
+    return true;
+}
+
+/*********************************
+*
+* Components:
+*
+*********************************/
+
+// Snapshots store the asset UUIDs, handles are re-acquired from the asset managers on load
+void ComponentSerializer<Sprite>::Write(SnapshotWriter& out, const Sprite& sprite) {
+    WriteAsset( out, sprite.mesh );
+    WriteAsset( out, sprite.shader );
+}
+
+void ComponentSerializer<Sprite>::Read(SnapshotReader& in, Sprite& sprite) {
+    ReadAsset( in, sprite.mesh );
+    ReadAsset( in, sprite.shader );
+}
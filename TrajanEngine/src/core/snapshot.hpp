@@ -0,0 +1,178 @@
+/*
+* File: snapshot.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "trajan_engine.hpp"
+
+// Binary world snapshots
+// Data is written in native layout, snapshots are meant to be read back by the same build on the same platform.
+// Pools are matched by component name and size on load, so component type IDs may differ between runs.
+// Kept light since every component pool includes it, asset and file IO live in snapshot.cpp / snapshot_assets.hpp.
+
+class AssetSystem;
+
+constexpr uint32_t SNAPSHOT_MAGIC = 0x534A5254; // "TRJS"
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+
+class SnapshotWriter {
+public:
+    void WriteBytes(const void* data, size_t size) {
+        if( size == 0 ) return;
+
+        const size_t at = bytes.size();
+        bytes.resize( at + size );
+        std::memcpy( bytes.data() + at, data, size );
+    }
+
+    template<typename T>
+    void Write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Write needs a trivially copyable type");
+        WriteBytes( &value, sizeof(T) );
+    }
+
+    // Bulk copy of count contiguous values
+    template<typename T>
+    void WriteArray(const T* data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "WriteArray needs a trivially copyable type");
+        WriteBytes( data, count * sizeof(T) );
+    }
+
+    void WriteString(std::string_view string) {
+        Write( static_cast<uint32_t>( string.size() ) );
+        WriteBytes( string.data(), string.size() );
+    }
+
+    // Writes a placeholder for a value only known later, returns where to Patch it
+    template<typename T>
+    size_t Reserve() {
+        const size_t at = bytes.size();
+        Write( T{} );
+        return at;
+    }
+
+    template<typename T>
+    void Patch(size_t at, const T& value) {
+        std::memcpy( bytes.data() + at, &value, sizeof(T) );
+    }
+
+    void ReserveCapacity(size_t size) { bytes.reserve( size ); }
+
+    [[nodiscard]] size_t Size() const { return bytes.size(); }
+    [[nodiscard]] std::vector<uint8_t>& Bytes() { return bytes; }
+
+private:
+    std::vector<uint8_t> bytes;
+};
+
+// Bounds-checked reader, every read after running past the end fails and leaves the output untouched
+class SnapshotReader {
+public:
+    // assets resolves AssetHandle UUIDs back into handles, may be nullptr if no component holds one
+    explicit SnapshotReader(std::span<const uint8_t> bytes, AssetSystem* assets = nullptr)
+        : bytes(bytes), assets(assets) {}
+
+    bool ReadBytes(void* data, size_t size) {
+        if( failed || size > bytes.size() - cursor ) {
+            failed = true;
+            return false;
+        }
+        if( size == 0 ) return true;
+
+        std::memcpy( data, bytes.data() + cursor, size );
+        cursor += size;
+        return true;
+    }
+
+    template<typename T>
+    bool Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "Read needs a trivially copyable type");
+        return ReadBytes( &value, sizeof(T) );
+    }
+
+    template<typename T>
+    bool ReadArray(T* data, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>, "ReadArray needs a trivially copyable type");
+        if( count > ( bytes.size() - cursor ) / sizeof(T) ) {
+            failed = true;
+            return false;
+        }
+        return ReadBytes( data, count * sizeof(T) );
+    }
+
+    bool ReadString(std::string& string) {
+        uint32_t size = 0;
+        if( !Read( size ) || size > bytes.size() - cursor ) {
+            failed = true;
+            return false;
+        }
+
+        string.assign( reinterpret_cast<const char*>( bytes.data() + cursor ), size );
+        cursor += size;
+        return true;
+    }
+
+    bool Skip(size_t size) {
+        if( failed || size > bytes.size() - cursor ) {
+            failed = true;
+            return false;
+        }
+        cursor += size;
+        return true;
+    }
+
+    [[nodiscard]] bool Failed() const { return failed; }
+    [[nodiscard]] size_t Remaining() const { return bytes.size() - cursor; }
+    [[nodiscard]] AssetSystem* Assets() const { return assets; }
+
+private:
+    std::span<const uint8_t> bytes;
+    size_t cursor = 0;
+    bool failed = false;
+    AssetSystem* assets = nullptr;
+};
+
+// Specialize for components that cannot be copied byte for byte, e.g. components holding AssetHandles:
+//     template<> struct ComponentSerializer<Sprite> {
+//         static void Write(SnapshotWriter& out, const Sprite& sprite);
+//         static void Read(SnapshotReader& in, Sprite& sprite);
+//     };
+// Definitions that need WriteAsset/ReadAsset include snapshot_assets.hpp in a source file.
+template<typename T>
+struct ComponentSerializer;
+
+template<typename T>
+concept CustomSerialized = requires(SnapshotWriter& out, SnapshotReader& in, const T& source, T& target) {
+    ComponentSerializer<T>::Write( out, source );
+    ComponentSerializer<T>::Read( in, target );
+};
+
+// Components without a serializer are bulk-copied if their bytes are all there is to them
+template<typename T>
+constexpr bool IsSerializableComponent = std::is_default_constructible_v<T> &&
+                                         ( CustomSerialized<T> || std::is_trivially_copyable_v<T> );
+
+// File helpers for save games
+TRAJANENGINE_API bool WriteSnapshotFile(const std::string& path, std::span<const uint8_t> bytes);
+TRAJANENGINE_API std::optional<std::vector<uint8_t>> ReadSnapshotFile(const std::string& path);
+
+#endif //SNAPSHOT_HPP
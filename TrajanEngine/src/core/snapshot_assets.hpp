@@ -0,0 +1,49 @@
+/*
+* File: snapshot_assets.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef SNAPSHOT_ASSETS_HPP
+#define SNAPSHOT_ASSETS_HPP
+
+#include "asset_handle.hpp"
+#include "asset_system.hpp"
+#include "log.hpp"
+#include "snapshot.hpp"
+
+// Serializer helpers for components holding AssetHandles, meant for source files so asset_system.hpp stays out of headers
+// Asset handles are stored as their UUID and resolved through the reader's AssetSystem
+template<typename T>
+void WriteAsset(SnapshotWriter& out, const AssetHandle<T>& handle) {
+    out.Write( handle.id() );
+}
+
+template<typename T>
+void ReadAsset(SnapshotReader& in, AssetHandle<T>& handle) {
+    UUID id;
+    if( !in.Read( id ) || id == UUID{} ) {
+        handle.reset();
+        return;
+    }
+
+    IAssetManagerT<T>* manager = in.Assets() ? in.Assets()->template GetFor<T>() : nullptr;
+    if( !manager ) {
+        Log::Warn("No asset manager to resolve asset " + id.toString() + " from snapshot");
+        handle.reset();
+        return;
+    }
+
+    handle = manager->loadFromGUID( id );
+    if( !handle.isValid() ) {
+        Log::Warn("Asset " + id.toString() + " from snapshot is not loaded");
+    }
+}
+
+#endif //SNAPSHOT_ASSETS_HPP
@@ -0,0 +1,131 @@
+/*
+* File: sparse_set.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef SPARSE_SET_HPP
+#define SPARSE_SET_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "entity.hpp"
+
+// Paged sparse set of entities
+// Sparse array maps entity index -> dense index, dense array holds the entity handles packed together.
+// Sparse pages are only allocated once an entity inside their range is inserted.
+// Lookups compare the full handle, so a stale generation is never found.
+class SparseSet {
+public:
+    // Sparse slot value for "entity not in set"
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    // Number of sparse slots per page
+    static constexpr size_t PAGE_SIZE = 4096;
+
+    [[nodiscard]] bool Contains(Entity entity) const {
+        return Find( entity ) != INVALID_INDEX;
+    }
+
+    // Returns dense index of entity, or INVALID_INDEX if not in the set
+    [[nodiscard]] uint32_t Find(Entity entity) const {
+        const size_t page = EntityIndex( entity ) / PAGE_SIZE;
+        if( page >= sparse.size() || !sparse[page] ) {
+            return INVALID_INDEX;
+        }
+        const uint32_t index = sparse[page][EntityIndex( entity ) % PAGE_SIZE];
+        return ( index != INVALID_INDEX && dense[index] == entity ) ? index : INVALID_INDEX;
+    }
+
+    // Returns dense index of an entity that is known to be in the set
+    [[nodiscard]] uint32_t Index(Entity entity) const {
+        return sparse[EntityIndex( entity ) / PAGE_SIZE][EntityIndex( entity ) % PAGE_SIZE];
+    }
+
+    // Appends entity to the dense array, returns its dense index
+    uint32_t Insert(Entity entity) {
+        const auto index = static_cast<uint32_t>( dense.size() );
+        Assure( entity ) = index;
+        dense.push_back( entity );
+        return index;
+    }
+
+    // Moves last entity into the removed entity's slot <- Goal is to maintain density
+    // Returns the dense index the removed entity occupied
+    uint32_t Remove(Entity entity) {
+        const uint32_t index = Index( entity );
+        const Entity last = dense.back();
+
+        dense[index] = last;
+        Slot( last ) = index;
+        Slot( entity ) = INVALID_INDEX;
+        dense.pop_back();
+
+        return index;
+    }
+
+    // Exchanges the entities at two dense indices
+    void Swap(uint32_t a, uint32_t b) {
+        if( a == b ) return;
+
+        std::swap( dense[a], dense[b] );
+        Slot( dense[a] ) = a;
+        Slot( dense[b] ) = b;
+    }
+
+    void Clear() {
+        for(Entity entity : dense) {
+            Slot( entity ) = INVALID_INDEX;
+        }
+        dense.clear();
+    }
+
+    void Reserve(size_t capacity) { dense.reserve( capacity ); }
+
+    [[nodiscard]] size_t Size() const { return dense.size(); }
+    [[nodiscard]] bool Empty() const { return dense.empty(); }
+
+    [[nodiscard]] const Entity* Data() const { return dense.data(); }
+    [[nodiscard]] Entity operator[](size_t index) const { return dense[index]; }
+
+    [[nodiscard]] auto begin() const { return dense.begin(); }
+    [[nodiscard]] auto end() const { return dense.end(); }
+
+private:
+    using Page = std::unique_ptr<uint32_t[]>;
+
+    // Page of sparse slots, allocating the page on first touch
+    uint32_t& Assure(Entity entity) {
+        const size_t page = EntityIndex( entity ) / PAGE_SIZE;
+        if( page >= sparse.size() ) {
+            sparse.resize( page + 1 );
+        }
+        if( !sparse[page] ) {
+            sparse[page] = std::make_unique<uint32_t[]>( PAGE_SIZE );
+            std::fill_n( sparse[page].get(), PAGE_SIZE, INVALID_INDEX );
+        }
+        return sparse[page][EntityIndex( entity ) % PAGE_SIZE];
+    }
+
+    uint32_t& Slot(Entity entity) {
+        return sparse[EntityIndex( entity ) / PAGE_SIZE][EntityIndex( entity ) % PAGE_SIZE];
+    }
+
+    // Entity index -> dense index, split into pages
+    std::vector<Page> sparse;
+
+    // Packed entities
+    std::vector<Entity> dense;
+};
+
+#endif //SPARSE_SET_HPP
@@ -12,20 +12,23 @@
 
 #ifndef SYSTEM_HPP
 #define SYSTEM_HPP
-#include <set>
-
+#include "change_tick.hpp"
 #include "entity.hpp"
+#include "sparse_set.hpp"
 
 class Window;
 class Orchestrator;
 class IRenderer;
+class JobSystem;
+class EventBus;
 
 // System context contains references to potentially useful references from the engine
 struct SystemContext {
     Orchestrator& orchestrator;
     IRenderer& renderer;
     Window& window;
-    // TODO: when I set up EventBus, put it here
+    JobSystem& jobs;
+    EventBus& events;
 };
 
 class System {
@@ -36,7 +39,21 @@ public:
     virtual void Update(float dt) = 0;
     virtual void Shutdown() = 0;
 
-    std::set<Entity> entities;
+    // Called once per displayed frame on the main thread, after that frame's simulation steps
+    // alpha is how far the frame lies between the last two steps (0..1), for interpolating what is drawn
+    virtual void Render(float alpha) {}
+
+    // Systems that must run on the thread calling UpdateSystems (e.g. ones issuing GPU work)
+    [[nodiscard]] virtual bool RequiresMainThread() const { return false; }
+
+    // Entities matching the system's signature, densely packed for iteration
+    SparseSet entities;
+
+    // Bumped whenever entities gains or loses a member, for systems caching data derived from it
+    uint32_t membershipVersion = 0;
+
+    // Change tick this system's last update started on, Changed/Added filters compare against it
+    Tick lastRunTick = 0;
 };
 
 #endif //SYSTEM_HPP
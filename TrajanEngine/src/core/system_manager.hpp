@@ -12,29 +12,49 @@
 
 #ifndef SYSTEM_MANAGER_HPP
 #define SYSTEM_MANAGER_HPP
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <typeindex>
+#include <vector>
 
+#include "change_tick.hpp"
 #include "component.hpp"
 #include "log.hpp"
 #include "system.hpp"
+#include "system_profiler.hpp"
+#include "trace.hpp"
+#include "job_system.hpp"
+
+// How UpdateSystems runs the registered systems
+enum class SystemScheduling {
+    Sequential,     // One after another in registration order
+    Parallel        // Systems with non-conflicting component access run concurrently
+};
 
 class SystemManager {
 public:
+    explicit SystemManager(ChangeClock& clock) : clock(clock) {}
+
     template<typename T>
     std::shared_ptr<T> RegisterSystem() {
         auto key = std::type_index(typeid(T));
 
-        if( systems.contains( key ) ) {
+        if( systemIndices.contains( key ) ) {
             Log::Error("Tried to register system type " + std::string(typeid(T).name()) + " more than once!");
             return nullptr;
         }
 
         // Create and return pointer to the system
         auto system = std::make_shared<T>();
-        systems.emplace( key, system );
-        order.emplace_back( system );
+        systemIndices.emplace( key, static_cast<uint32_t>( order.size() ) );
+        SystemEntry entry;
+        entry.system = system;
+        entry.name = typeid(T).name();
+        order.push_back( std::move(entry) );
+        graphDirty = true;
         return system;
     }
 
@@ -42,73 +62,379 @@ public:
     void SetSignature(Signature signature) {
         auto key = std::type_index(typeid(T));
 
-        if( !systems.contains( key ) ) {
+        auto it = systemIndices.find( key );
+        if( it == systemIndices.end() ) {
             Log::Error("System type " + std::string(typeid(T).name()) + " not registered!");
             return;
         }
 
         // Set signature for the system
-        signatures[key] = signature;
+        SystemEntry& entry = order[it->second];
+        entry.signature = signature;
+        entry.hasSignature = true;
+
+        RebuildComponentIndex();
+    }
+
+    // Declares the component types a system reads and writes, systems without a declaration run exclusively
+    template<typename T>
+    void SetAccess(const Signature& reads, const Signature& writes) {
+        auto it = systemIndices.find( std::type_index(typeid(T)) );
+        if( it == systemIndices.end() ) {
+            Log::Error("System type " + std::string(typeid(T).name()) + " not registered!");
+            return;
+        }
+
+        SystemEntry& entry = order[it->second];
+        entry.reads = reads;
+        entry.writes = writes;
+        entry.hasAccess = true;
+        graphDirty = true;
+    }
+
+    // Adds to a system's access declaration, for components it touches outside its signature
+    template<typename T>
+    void AddAccess(const Signature& reads, const Signature& writes) {
+        auto it = systemIndices.find( std::type_index(typeid(T)) );
+        if( it == systemIndices.end() ) {
+            Log::Error("System type " + std::string(typeid(T).name()) + " not registered!");
+            return;
+        }
+
+        SystemEntry& entry = order[it->second];
+        entry.reads = entry.reads | reads;
+        entry.writes = entry.writes | writes;
+        entry.hasAccess = true;
+        graphDirty = true;
+    }
+
+    // Parallel mode runs systems on the given job system's workers
+    void SetScheduling(SystemScheduling mode, JobSystem* jobSystem) {
+        if( mode == SystemScheduling::Parallel && !jobSystem ) {
+            Log::Error("Parallel system scheduling needs a job system, staying sequential");
+            return;
+        }
+
+        scheduling = mode;
+        jobs = jobSystem;
+    }
+
+    [[nodiscard]] SystemScheduling GetScheduling() const { return scheduling; }
+
+    [[nodiscard]] bool HasMainThreadSystems() const {
+        return std::any_of( order.begin(), order.end(), [](const SystemEntry& entry) {
+            return entry.system->RequiresMainThread();
+        });
     }
 
     void InitializeSystems(const SystemContext& ctx) {
-        for(auto& sys : order) {
-            sys->Initialize(ctx);
+        for(auto& entry : order) {
+#ifdef TRAJAN_PROFILE_SYSTEMS
+            const auto start = SystemProfile::Clock::now();
+            entry.system->Initialize(ctx);
+            entry.profile.RecordInitialize( SystemProfile::Nanoseconds( start, SystemProfile::Clock::now() ) );
+#else
+            entry.system->Initialize(ctx);
+#endif
         }
     }
 
     void UpdateSystems(float dt) {
-        for(auto& sys : order) {
-            sys->Update(dt);
+        if( scheduling == SystemScheduling::Parallel && order.size() > 1 ) {
+            UpdateParallel( dt );
+            return;
+        }
+
+        for(auto& entry : order) {
+            RunSystem( entry, dt );
+        }
+    }
+
+    void RenderSystems(float alpha) {
+        for(auto& entry : order) {
+            entry.system->Render( alpha );
         }
     }
 
     void ShutdownSystems() {
-        for(auto& sys : order) {
-            sys->Shutdown();
+        for(auto& entry : order) {
+#ifdef TRAJAN_PROFILE_SYSTEMS
+            const auto start = SystemProfile::Clock::now();
+            entry.system->Shutdown();
+            entry.profile.RecordShutdown( SystemProfile::Nanoseconds( start, SystemProfile::Clock::now() ) );
+#else
+            entry.system->Shutdown();
+#endif
         }
     }
 
-    void EntityDestroyed(Entity entity) {
-        // Erase destroyed entity from all system lists
-        for( auto const& pair : systems ) {
-            auto const& system = pair.second;
+    // Timing of every system in registration order, empty unless built with TRAJAN_PROFILE_SYSTEMS
+    [[nodiscard]] std::vector<SystemTimings> GetSystemTimings() const {
+        std::vector<SystemTimings> timings;
+#ifdef TRAJAN_PROFILE_SYSTEMS
+        timings.reserve( order.size() );
+        for(const auto& entry : order) {
+            timings.push_back( entry.profile.Summarize( entry.name ) );
+        }
+#endif
+        return timings;
+    }
 
-            system->entities.erase( entity );
+    void ResetSystemTimings() {
+#ifdef TRAJAN_PROFILE_SYSTEMS
+        for(auto& entry : order) {
+            entry.profile.Reset();
         }
+#endif
+    }
+
+    void EntityDestroyed(Entity entity, const Signature& signature) {
+        // Erase destroyed entity from every system that could have held it
+        ForEachCandidate( signature, [&](SystemEntry& entry) {
+            if( entry.system->entities.Contains( entity ) ) {
+                entry.system->entities.Remove( entity );
+                ++entry.system->membershipVersion;
+            }
+        });
     }
 
-    void EntitySignatureChanged(Entity entity, Signature signature) {
-        // Notify each system of signature change
-        for( auto const& pair : systems ) {
-            auto const& key   = pair.first;
-            auto const& system = pair.second;
+    // Batch of new entities sharing one signature, each matching system takes the whole batch
+    void EntitiesCreated(std::span<const Entity> batch, const Signature& signature) {
+        ForEachCandidate( signature, [&](SystemEntry& entry) {
+            if( !signature.Contains( entry.signature ) ) return;
 
-            auto it = signatures.find( key );
-            if(it == signatures.end() ) {
-                // No signature for this system yet, skip
-                continue;
+            SparseSet& members = entry.system->entities;
+            members.Reserve( members.Size() + batch.size() );
+            for(Entity entity : batch) {
+                members.Insert( entity );
+            }
+            ++entry.system->membershipVersion;
+        });
+    }
+
+    // Batch form of EntityDestroyed, signatures is the union of every destroyed entity's signature
+    void EntitiesDestroyed(std::span<const Entity> batch, const Signature& signatures) {
+        ForEachCandidate( signatures, [&](SystemEntry& entry) {
+            SparseSet& members = entry.system->entities;
+            const size_t before = members.Size();
+            for(Entity entity : batch) {
+                if( members.Contains( entity ) ) members.Remove( entity );
+            }
+            if( members.Size() != before ) ++entry.system->membershipVersion;
+        });
+    }
+
+    void EntitySignatureChanged(Entity entity, const Signature& previous, const Signature& signature) {
+        // Only systems that read one of the flipped component types can change membership
+        ForEachCandidate( previous ^ signature, [&](SystemEntry& entry) {
+            const bool member = entry.system->entities.Contains( entity );
+            if( signature.Contains( entry.signature ) ) {
+                if( member ) return;
+                entry.system->entities.Insert( entity );
             }
-            const auto& system_sig = it->second;
-            if( (signature & system_sig) == system_sig ) {
-                system->entities.insert( entity );
+            else if( member ) {
+                entry.system->entities.Remove( entity );
             }
             else {
-                system->entities.erase( entity );
+                return;
             }
-        }
+            ++entry.system->membershipVersion;
+        });
     }
 
 private:
-    // Map: System Type (C String) -> Signature
-    std::unordered_map<std::type_index, Signature> signatures{};
+    struct SystemEntry {
+        std::shared_ptr<System> system;
+        Signature signature{};
+
+        // Systems without a signature yet are never matched
+        bool hasSignature = false;
+
+        // Last candidate pass that visited this system, avoids visiting it once per shared component
+        uint32_t visitedPass = 0;
+
+        // Declared component access, systems without one conflict with every other system
+        Signature reads{};
+        Signature writes{};
+        bool hasAccess = false;
 
-    // Map: System Type (C String) -> System Ptr
-    std::unordered_map<std::type_index, std::shared_ptr<System>> systems{};
+        // Dependency graph: earlier systems this one must wait for
+        std::vector<uint32_t> dependencies;
+
+        // Type name, used for timings and trace zones
+        const char* name = "";
+
+#ifdef TRAJAN_PROFILE_SYSTEMS
+        SystemProfile profile;
+#endif
+    };
+
+    // Updates one system with its last run tick visible to the views it creates
+    void RunSystem(SystemEntry& entry, float dt) {
+        System& system = *entry.system;
+        const Tick tick = clock.Advance();
+
+        Tick& since = ChangeClock::ThreadSince();
+        const Tick outer = since;
+        since = system.lastRunTick;
+
+        TRAJAN_TRACE_ZONE( entry.name );
+
+#ifdef TRAJAN_PROFILE_SYSTEMS
+        const auto start = SystemProfile::Clock::now();
+        system.Update( dt );
+        entry.profile.RecordUpdate( SystemProfile::Nanoseconds( start, SystemProfile::Clock::now() ),
+                                    static_cast<uint32_t>( system.entities.Size() ) );
+#else
+        system.Update( dt );
+#endif
+
+        since = outer;
+        system.lastRunTick = tick;
+    }
+
+    // Two systems conflict if either writes something the other touches
+    static bool Conflicts(const SystemEntry& a, const SystemEntry& b) {
+        if( !a.hasAccess || !b.hasAccess ) return true;
+        return a.writes.Intersects( b.reads | b.writes ) || b.writes.Intersects( a.reads );
+    }
+
+    // Conflicting pairs keep their registration order, everything else is free to overlap
+    void BuildGraph() {
+        for(uint32_t later = 0; later < order.size(); ++later) {
+            order[later].dependencies.clear();
+            for(uint32_t earlier = 0; earlier < later; ++earlier) {
+                if( Conflicts( order[earlier], order[later] ) ) {
+                    order[later].dependencies.push_back( earlier );
+                }
+            }
+        }
+
+        graphDirty = false;
+    }
+
+    /*
+     *  Function: UpdateParallel
+     *
+     *  Description:
+     *      Runs one frame of the dependency graph on the job system. Every system becomes a job
+     *      depending on the jobs of the earlier systems it conflicts with. Main thread systems are
+     *      run by the calling thread in registration order once their dependencies finished, it
+     *      helps run jobs while waiting, so this is safe to call from inside a job.
+     *      Returns once every system has updated.
+     *
+     *  In:
+     *      dt - frame delta passed to every system
+     *
+     *  Out:
+     *      none
+     */
+    void UpdateParallel(float dt) {
+        if( graphDirty ) BuildGraph();
+
+        handles.assign( order.size(), JobHandle{} );
+        started.assign( order.size(), 0 );
+
+        uint32_t next = 0;
+        while( true ) {
+            // Queue every worker system whose dependencies are queued or already ran
+            for(uint32_t index = next; index < order.size(); ++index) {
+                if( started[index] || order[index].system->RequiresMainThread() ) continue;
+
+                const std::vector<uint32_t>& dependencies = order[index].dependencies;
+                if( !std::all_of( dependencies.begin(), dependencies.end(), [this](uint32_t dependency) { return started[dependency]; } ) ) {
+                    continue;
+                }
+
+                dependencyHandles.clear();
+                for(uint32_t dependency : dependencies) {
+                    dependencyHandles.push_back( handles[dependency] );
+                }
+                handles[index] = jobs->Schedule( [this, index, dt] { RunSystem( order[index], dt ); }, dependencyHandles );
+                started[index] = 1;
+            }
+
+            while( next < order.size() && started[next] ) ++next;
+            if( next == order.size() ) break;
+
+            // Everything before it is queued, so the first system not started is a main thread system
+            for(uint32_t dependency : order[next].dependencies) {
+                jobs->Wait( handles[dependency] );
+            }
+            RunSystem( order[next], dt );
+            started[next] = 1;
+        }
+
+        for(const JobHandle& handle : handles) {
+            jobs->Wait( handle );
+        }
+    }
+
+    // Calls fn once for each system whose signature shares a component type with changed, and for every
+    // system with an empty signature
+    template<typename Fn>
+    void ForEachCandidate(const Signature& changed, Fn&& fn) {
+        ++candidatePass;
+
+        auto visit = [&](uint32_t index) {
+            SystemEntry& entry = order[index];
+            if( entry.visitedPass == candidatePass ) return;
+            entry.visitedPass = candidatePass;
+            fn( entry );
+        };
+
+        changed.ForEach([&](size_t type) {
+            for(uint32_t index : systemsByComponent[type]) visit( index );
+        });
+
+        // An empty signature matches every living entity, so those systems see every creation, change and destruction
+        for(uint32_t index : unfilteredSystems) visit( index );
+    }
+
+    void RebuildComponentIndex() {
+        for(auto& list : systemsByComponent) list.clear();
+        unfilteredSystems.clear();
+
+        for(uint32_t index = 0; index < order.size(); ++index) {
+            const SystemEntry& entry = order[index];
+            if( !entry.hasSignature ) continue;
+
+            if( entry.signature.none() ) {
+                unfilteredSystems.push_back( index );
+                continue;
+            }
+            entry.signature.ForEach([&](size_t type) {
+                systemsByComponent[type].push_back( index );
+            });
+        }
+    }
+
+    // Map: System Type -> Index into order
+    std::unordered_map<std::type_index, uint32_t> systemIndices{};
 
     // List of existing systems for in-order iteration
     // TODO: Refactor this to include order
-    std::vector<std::shared_ptr<System>> order;
+    std::vector<SystemEntry> order;
+
+    // Component Type -> systems whose signature includes it
+    std::array<std::vector<uint32_t>, MAX_COMPONENTS> systemsByComponent{};
+
+    // Systems registered with an empty signature
+    std::vector<uint32_t> unfilteredSystems;
+
+    uint32_t candidatePass = 0;
+
+    ChangeClock& clock;
+
+    // Scheduling
+    SystemScheduling scheduling = SystemScheduling::Sequential;
+    JobSystem* jobs = nullptr;
+    bool graphDirty = true;
+
+    // Per-frame state of the parallel update: each system's job, and whether it was queued or ran
+    std::vector<JobHandle> handles;
+    std::vector<uint8_t> started;
+    std::vector<JobHandle> dependencyHandles;
 };
 
 #endif //SYSTEMMANAGER_HPP
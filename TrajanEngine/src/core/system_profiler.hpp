@@ -0,0 +1,134 @@
+/*
+* File: system_profiler.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef SYSTEM_PROFILER_HPP
+#define SYSTEM_PROFILER_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Per-system timing, compiled in with TRAJAN_PROFILE_SYSTEMS (CMake option of the same name)
+#ifdef TRAJAN_PROFILE_SYSTEMS
+constexpr bool SYSTEM_PROFILING_ENABLED = true;
+#else
+constexpr bool SYSTEM_PROFILING_ENABLED = false;
+#endif
+
+// Number of recent updates kept per system
+constexpr size_t SYSTEM_PROFILE_FRAMES = 256;
+
+// Summary of one system over the recorded updates, times in milliseconds
+struct SystemTimings {
+    std::string name;
+
+    float minMs = 0.0f;
+    float avgMs = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+    float lastMs = 0.0f;
+
+    float initializeMs = 0.0f;
+    float shutdownMs = 0.0f;
+
+    // Entities the system held during its last update, and on average
+    uint32_t entities = 0;
+    float avgEntities = 0.0f;
+
+    // Updates the statistics cover (at most SYSTEM_PROFILE_FRAMES)
+    uint32_t samples = 0;
+};
+
+// Ring of recent update times of one system
+// Only written by the thread running the system, read between frames.
+class SystemProfile {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static uint64_t Nanoseconds(Clock::time_point start, Clock::time_point stop) {
+        return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( stop - start ).count() );
+    }
+
+    void RecordUpdate(uint64_t nanoseconds, uint32_t entityCount) {
+        updateNs[head] = nanoseconds;
+        entities[head] = entityCount;
+        head = ( head + 1 ) % SYSTEM_PROFILE_FRAMES;
+        count = std::min<uint32_t>( count + 1, SYSTEM_PROFILE_FRAMES );
+    }
+
+    void RecordInitialize(uint64_t nanoseconds) { initializeNs = nanoseconds; }
+    void RecordShutdown(uint64_t nanoseconds) { shutdownNs = nanoseconds; }
+
+    /*
+     *  Function: Summarize
+     *
+     *  Description:
+     *      Reduces the ring to min/avg/p99/max. Sorts a copy, so it is meant for tools
+     *      polling once per frame or less, not for the update path.
+     *
+     *  In:
+     *      name - system name to report
+     *
+     *  Out:
+     *      SystemTimings - statistics over the recorded updates
+     */
+    [[nodiscard]] SystemTimings Summarize(const std::string& name) const {
+        constexpr float NS_TO_MS = 1.0e-6f;
+
+        SystemTimings timings;
+        timings.name = name;
+        timings.samples = count;
+        timings.initializeMs = static_cast<float>( initializeNs ) * NS_TO_MS;
+        timings.shutdownMs = static_cast<float>( shutdownNs ) * NS_TO_MS;
+        if( count == 0 ) return timings;
+
+        std::array<uint64_t, SYSTEM_PROFILE_FRAMES> sorted;
+        uint64_t total = 0;
+        uint64_t totalEntities = 0;
+        for(uint32_t i = 0; i < count; ++i) {
+            sorted[i] = updateNs[i];
+            total += updateNs[i];
+            totalEntities += entities[i];
+        }
+        std::sort( sorted.begin(), sorted.begin() + count );
+
+        const uint32_t last = ( head + SYSTEM_PROFILE_FRAMES - 1 ) % SYSTEM_PROFILE_FRAMES;
+        const uint32_t p99 = std::min( count - 1, ( count * 99 ) / 100 );
+
+        timings.minMs = static_cast<float>( sorted[0] ) * NS_TO_MS;
+        timings.maxMs = static_cast<float>( sorted[count - 1] ) * NS_TO_MS;
+        timings.p99Ms = static_cast<float>( sorted[p99] ) * NS_TO_MS;
+        timings.avgMs = static_cast<float>( total ) / static_cast<float>( count ) * NS_TO_MS;
+        timings.lastMs = static_cast<float>( updateNs[last] ) * NS_TO_MS;
+        timings.entities = entities[last];
+        timings.avgEntities = static_cast<float>( totalEntities ) / static_cast<float>( count );
+        return timings;
+    }
+
+    void Reset() {
+        head = 0;
+        count = 0;
+    }
+
+private:
+    std::array<uint64_t, SYSTEM_PROFILE_FRAMES> updateNs{};
+    std::array<uint32_t, SYSTEM_PROFILE_FRAMES> entities{};
+    uint32_t head = 0;
+    uint32_t count = 0;
+
+    uint64_t initializeNs = 0;
+    uint64_t shutdownNs = 0;
+};
+
+#endif //SYSTEM_PROFILER_HPP
@@ -0,0 +1,195 @@
+/*
+* File: trace.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "trace.hpp"
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "log.hpp"
+
+namespace {
+    struct TraceEvent {
+        const char* name;
+        uint64_t startNs;
+        uint64_t durationNs;
+    };
+
+    // One writer (its thread), read by the exporter
+    struct ThreadBuffer {
+        uint32_t threadId = 0;
+        std::atomic<const char*> name{ nullptr };
+
+        std::unique_ptr<TraceEvent[]> events;
+
+        // Published with release after the event is written, so the exporter only sees complete events
+        std::atomic<uint32_t> count{ 0 };
+        std::atomic<uint32_t> dropped{ 0 };
+
+        // Capture the buffer holds events of, the writer resets itself when a new capture started
+        std::atomic<uint32_t> capture{ 0 };
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+        std::atomic<bool> recording{ false };
+        std::atomic<uint32_t> capture{ 0 };
+
+        const Trace::Clock::time_point origin = Trace::Clock::now();
+    };
+
+    Registry& GetRegistry() {
+        static Registry registry;
+        return registry;
+    }
+
+    // Registered once per thread, buffers stay alive after their thread exits so its zones can still be exported
+    ThreadBuffer& GetThreadBuffer() {
+        static thread_local ThreadBuffer* buffer = nullptr;
+        if( buffer ) return *buffer;
+
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        auto owned = std::make_unique<ThreadBuffer>();
+        owned->threadId = static_cast<uint32_t>( registry.buffers.size() + 1 );
+        owned->events = std::make_unique<TraceEvent[]>( Trace::EVENTS_PER_THREAD );
+        buffer = owned.get();
+        registry.buffers.push_back( std::move(owned) );
+        return *buffer;
+    }
+
+    uint64_t SinceOrigin(Trace::Clock::time_point time) {
+        const auto elapsed = time - GetRegistry().origin;
+        return static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() );
+    }
+
+    void WriteJsonString(std::FILE* file, const char* string) {
+        std::fputc('"', file);
+        for(const char* c = string; *c; ++c) {
+            if( *c == '"' || *c == '\\' ) std::fputc('\\', file);
+            std::fputc(*c, file);
+        }
+        std::fputc('"', file);
+    }
+}
+
+namespace Trace {
+    void Start() {
+        Registry& registry = GetRegistry();
+        registry.capture.fetch_add( 1, std::memory_order_acq_rel );
+        registry.recording.store( true, std::memory_order_release );
+    }
+
+    void Stop() {
+        GetRegistry().recording.store( false, std::memory_order_release );
+    }
+
+    bool IsRecording() {
+        return GetRegistry().recording.load( std::memory_order_relaxed );
+    }
+
+    void Record(const char* name, Clock::time_point start, Clock::time_point end) {
+        ThreadBuffer& buffer = GetThreadBuffer();
+
+        // First zone of a new capture on this thread: forget the old one
+        const uint32_t capture = GetRegistry().capture.load( std::memory_order_acquire );
+        if( buffer.capture.load( std::memory_order_relaxed ) != capture ) {
+            buffer.count.store( 0, std::memory_order_relaxed );
+            buffer.dropped.store( 0, std::memory_order_relaxed );
+            buffer.capture.store( capture, std::memory_order_release );
+        }
+
+        const uint32_t index = buffer.count.load( std::memory_order_relaxed );
+        if( index >= EVENTS_PER_THREAD ) {
+            buffer.dropped.fetch_add( 1, std::memory_order_relaxed );
+            return;
+        }
+
+        const uint64_t startNs = SinceOrigin( start );
+        buffer.events[index] = { name, startNs, SinceOrigin( end ) - startNs };
+        buffer.count.store( index + 1, std::memory_order_release );
+    }
+
+    void SetThreadName(const char* name) {
+        GetThreadBuffer().name.store( name, std::memory_order_release );
+    }
+
+    /*
+     *  Function: WriteChromeJson
+     *
+     *  Description:
+     *      Writes every thread's zones of the current capture as complete ("X") events in
+     *      the Chrome trace event format, plus thread name metadata. Times are microseconds.
+     *
+     *  In:
+     *      path - output file
+     *
+     *  Out:
+     *      bool - false if the file could not be written
+     */
+    bool WriteChromeJson(const std::string& path) {
+        std::FILE* file = std::fopen( path.c_str(), "w" );
+        if( !file ) {
+            Log::Error("Could not open trace file " + path + " for writing");
+            return false;
+        }
+
+        Registry& registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const uint32_t capture = registry.capture.load( std::memory_order_acquire );
+
+        std::fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+        bool first = true;
+        uint64_t dropped = 0;
+
+        for(const auto& buffer : registry.buffers) {
+            if( const char* name = buffer->name.load( std::memory_order_acquire ) ) {
+                std::fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":",
+                             first ? "" : ",\n", buffer->threadId);
+                WriteJsonString( file, name );
+                std::fprintf(file, "}}");
+                first = false;
+            }
+
+            if( buffer->capture.load( std::memory_order_acquire ) != capture ) continue;
+
+            const uint32_t count = buffer->count.load( std::memory_order_acquire );
+            dropped += buffer->dropped.load( std::memory_order_relaxed );
+            for(uint32_t i = 0; i < count; ++i) {
+                const TraceEvent& event = buffer->events[i];
+                std::fprintf(file, "%s{\"name\":", first ? "" : ",\n");
+                WriteJsonString( file, event.name );
+                std::fprintf(file, ",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                             buffer->threadId, static_cast<double>( event.startNs ) / 1000.0,
+                             static_cast<double>( event.durationNs ) / 1000.0);
+                first = false;
+            }
+        }
+
+        std::fprintf(file, "\n]}\n");
+        const bool written = std::fclose( file ) == 0;
+
+        if( dropped > 0 ) {
+            Log::Warn("Trace buffers were full, " + std::to_string(dropped) + " zones were dropped");
+        }
+        if( !written ) {
+            Log::Error("Could not write trace file " + path);
+        }
+        return written;
+    }
+}
@@ -0,0 +1,81 @@
+/*
+* File: trace.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include "trajan_engine.hpp"
+
+// Scoped trace zones, compiled in with TRAJAN_TRACE (CMake option of the same name)
+// Every thread records into its own buffer without locking, a capture is written out as Chrome trace
+// JSON (chrome://tracing, Perfetto, Speedscope):
+//     Trace::Start();
+//     ... frames ...
+//     Trace::Stop();
+//     Trace::WriteChromeJson("capture.json");
+namespace Trace {
+    using Clock = std::chrono::steady_clock;
+
+    // Completed zones kept per thread and capture, later zones are dropped
+    constexpr uint32_t EVENTS_PER_THREAD = 1 << 16;
+
+    // Discards the previous capture and starts recording
+    TRAJANENGINE_API void Start();
+    TRAJANENGINE_API void Stop();
+    TRAJANENGINE_API bool IsRecording();
+
+    // Adds a completed zone to the calling thread's buffer, name must outlive the capture (string literal, typeid name)
+    TRAJANENGINE_API void Record(const char* name, Clock::time_point start, Clock::time_point end);
+
+    // Label of the calling thread in the exported trace
+    TRAJANENGINE_API void SetThreadName(const char* name);
+
+    // Writes the current capture, best called after Stop
+    TRAJANENGINE_API bool WriteChromeJson(const std::string& path);
+
+    // Records its own lifetime as a zone if a capture was running when it was created
+    class Zone {
+    public:
+        explicit Zone(const char* name) : name(name), active(IsRecording()) {
+            if( active ) start = Clock::now();
+        }
+
+        ~Zone() {
+            if( active ) Record( name, start, Clock::now() );
+        }
+
+        Zone(const Zone&) = delete;
+        Zone& operator=(const Zone&) = delete;
+
+    private:
+        const char* name;
+        bool active;
+        Clock::time_point start{};
+    };
+}
+
+#define TRAJAN_TRACE_CONCAT_INNER(a, b) a##b
+#define TRAJAN_TRACE_CONCAT(a, b) TRAJAN_TRACE_CONCAT_INNER(a, b)
+
+#ifdef TRAJAN_TRACE
+    #define TRAJAN_TRACE_ZONE(name) Trace::Zone TRAJAN_TRACE_CONCAT(traceZone, __LINE__)( name )
+    #define TRAJAN_TRACE_THREAD(name) Trace::SetThreadName( name )
+#else
+    #define TRAJAN_TRACE_ZONE(name) ((void)0)
+    #define TRAJAN_TRACE_THREAD(name) ((void)0)
+#endif
+
+#endif //TRACE_HPP
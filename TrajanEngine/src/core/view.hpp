@@ -0,0 +1,352 @@
+/*
+* File: view.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef VIEW_HPP
+#define VIEW_HPP
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "archetype_manager.hpp"
+#include "component_manager.hpp"
+#include "job_system.hpp"
+
+// Typed iteration over every entity owning all of Ts...
+// Const-qualified types (View<const Sprite>) are handed out as const references, non-const ones
+// are stamped as changed for every entity visited.
+// Structural changes (add/remove/destroy) must not happen inside Each, use the command buffer instead.
+template<typename... Ts>
+class ComponentView {
+    static_assert(sizeof...(Ts) > 0, "View needs at least one component type");
+
+public:
+    // now = tick stamped on mutable access, since = tick Changed/Added filters compare against
+    ComponentView(StorageBackend backend, ComponentManager& components, ArchetypeManager* archetypes,
+                  JobSystem* jobs = nullptr, Tick now = 0, Tick since = 0)
+        : backend(backend), archetypes(archetypes), jobs(jobs), now(now), since(since),
+          types{ components.GetComponentType<std::remove_const_t<Ts>>()... }
+    {
+        if( backend == StorageBackend::SparseSet ) {
+            pools = std::make_tuple( components.GetComponentArray<std::remove_const_t<Ts>>()... );
+            FindGroup( components );
+        }
+    }
+
+    // Only entities whose T changed (or was added) since the filter tick, e.g. View<const Transform2D>().Changed<Transform2D>()
+    template<typename T>
+    ComponentView& Changed() {
+        static_assert(IndexOf<T>() < sizeof...(Ts), "Changed<T> needs T to be part of the view");
+        static_assert(!IsTagComponent<T>, "Tag components carry no change ticks");
+        filters[IndexOf<T>()] |= CHANGED;
+        return *this;
+    }
+
+    // Only entities that gained T since the filter tick
+    template<typename T>
+    ComponentView& Added() {
+        static_assert(IndexOf<T>() < sizeof...(Ts), "Added<T> needs T to be part of the view");
+        static_assert(!IsTagComponent<T>, "Tag components carry no change ticks");
+        filters[IndexOf<T>()] |= ADDED;
+        return *this;
+    }
+
+    // Overrides the filter tick, which defaults to the last run of the calling system
+    ComponentView& Since(Tick tick) {
+        since = tick;
+        return *this;
+    }
+
+    /*
+     *  Function: Each
+     *
+     *  Description:
+     *      Calls fn for every matching entity, with references straight into storage.
+     *      Sparse sets are driven from the smallest pool, archetypes stream matching chunks.
+     *
+     *  In:
+     *      fn - callable as fn(Entity, Ts&...) or fn(Ts&...)
+     *
+     *  Out:
+     *      none
+     */
+    template<typename Fn>
+    void Each(Fn&& fn) {
+        if( backend == StorageBackend::Archetype ) {
+            EachChunked( fn, std::index_sequence_for<Ts...>{} );
+        }
+        else {
+            EachSparse( fn, std::index_sequence_for<Ts...>{} );
+        }
+    }
+
+    /*
+     *  Function: ParallelEach
+     *
+     *  Description:
+     *      Each, split across the job system's workers and joined before returning.
+     *      Sparse sets split the smallest pool's dense range into chunks that start on cache line
+     *      boundaries, archetypes hand out whole chunks. Every entity lands in exactly one chunk,
+     *      so no component is touched by two jobs. Runs serially without a job system.
+     *
+     *  In:
+     *      fn    - callable as fn(Entity, Ts&...) or fn(Ts&...), invoked concurrently
+     *      grain - minimum entities per job on the sparse path, 0 = pick from worker count
+     *
+     *  Out:
+     *      none
+     */
+    template<typename Fn>
+    void ParallelEach(Fn&& fn, size_t grain = 0) {
+        if( !jobs ) {
+            Each( fn );
+            return;
+        }
+
+        if( backend == StorageBackend::Archetype ) {
+            ParallelChunked( fn, std::index_sequence_for<Ts...>{} );
+        }
+        else {
+            ParallelSparse( fn, grain, std::index_sequence_for<Ts...>{} );
+        }
+    }
+
+private:
+    static constexpr uint8_t CHANGED = 1;
+    static constexpr uint8_t ADDED = 2;
+
+    // Position of T in Ts..., filters may only name types the view already holds
+    template<typename T>
+    static constexpr size_t IndexOf() {
+        constexpr std::array<bool, sizeof...(Ts)> matches{ std::is_same_v<std::remove_const_t<T>, std::remove_const_t<Ts>>... };
+        size_t index = 0;
+        while( index < matches.size() && !matches[index] ) ++index;
+        return index;
+    }
+
+    template<size_t I>
+    using TypeAt = std::tuple_element_t<I, std::tuple<Ts...>>;
+
+    // Tag slots have no storage: every row reads the shared instance at index 0 and there are no ticks
+    template<size_t I>
+    static constexpr bool IS_TAG = IsTagComponent<TypeAt<I>>;
+
+    template<size_t I>
+    static TypeAt<I>& Ref(std::remove_const_t<TypeAt<I>>* base, size_t index) {
+        if constexpr ( IS_TAG<I> ) {
+            return *base;
+        }
+        else {
+            return base[index];
+        }
+    }
+
+    // Applies the filter of view slot I to a component's ticks
+    template<size_t I>
+    bool Passes(const ComponentTicks* ticks, size_t index) const {
+        if constexpr ( IS_TAG<I> ) {
+            return true;
+        }
+        else {
+            if( ( filters[I] & CHANGED ) && !IsNewer( ticks[index].changed, since ) ) return false;
+            if( ( filters[I] & ADDED ) && !IsNewer( ticks[index].added, since ) ) return false;
+            return true;
+        }
+    }
+
+    // Mutable slots mark the component changed on access
+    template<size_t I>
+    void Stamp(ComponentTicks* ticks, size_t index) const {
+        if constexpr ( !IS_TAG<I> && !std::is_const_v<TypeAt<I>> ) {
+            ticks[index].changed = now;
+        }
+    }
+
+    // Elements per chunk step so every chunk of every pool starts on a cache line
+    static constexpr size_t CHUNK_UNIT = std::max( { ( IsTagComponent<Ts> ? 1 : CACHE_LINE_SIZE / std::gcd( sizeof(Ts), CACHE_LINE_SIZE ) )... } );
+
+    template<typename T>
+    using Pool = ComponentArray<std::remove_const_t<T>>;
+
+    template<typename Fn, typename... Args>
+    static void Invoke(Fn& fn, Entity entity, Args&... args) {
+        if constexpr ( std::is_invocable_v<Fn&, Entity, Args&...> ) {
+            fn( entity, args... );
+        }
+        else {
+            fn( args... );
+        }
+    }
+
+    // Picks a group whose owned types are all part of the view, its packed range holds every match
+    void FindGroup(ComponentManager& components) {
+        Signature required;
+        for(ComponentType type : types) required.set( type );
+
+        for(ComponentType type : types) {
+            Group* candidate = components.GetGroup( type );
+            if( candidate && required.Contains( candidate->Types() ) ) {
+                group = candidate;
+                break;
+            }
+        }
+        if( !group ) return;
+
+        for(size_t i = 0; i < types.size(); ++i) {
+            grouped[i] = group->Types().test( types[i] );
+        }
+    }
+
+    // Pool iteration is driven from, with the number of leading entries to walk
+    // A group's packed range when there is one, otherwise the pool with the fewest entities
+    // nullptr if any pool is missing
+    template<size_t... I>
+    const SparseSet* Lead(size_t& count, std::index_sequence<I...>) const {
+        if( ( ... || ( std::get<I>(pools) == nullptr ) ) ) return nullptr;
+
+        const SparseSet* lead = &std::get<0>(pools)->Entities();
+        if( group ) {
+            ( ..., ( grouped[I] ? (void)( lead = &std::get<I>(pools)->Entities() ) : (void)0 ) );
+            count = group->Size();
+            return lead;
+        }
+
+        ( ..., ( std::get<I>(pools)->Size() < lead->Size() ? (void)( lead = &std::get<I>(pools)->Entities() ) : (void)0 ) );
+        count = lead->Size();
+        return lead;
+    }
+
+    template<typename Fn, size_t... I>
+    void EachSparse(Fn& fn, std::index_sequence<I...> sequence) {
+        size_t count = 0;
+        if( const SparseSet* lead = Lead( count, sequence ) ) {
+            VisitSparse( fn, *lead, 0, count, sequence );
+        }
+    }
+
+    template<typename Fn, size_t... I>
+    void ParallelSparse(Fn& fn, size_t grain, std::index_sequence<I...> sequence) {
+        size_t count = 0;
+        const SparseSet* lead = Lead( count, sequence );
+        if( !lead || count == 0 ) return;
+
+        // A few jobs per worker for balance, rounded up to whole cache lines
+        const size_t workers = jobs->WorkerCount() + 1;
+        size_t chunk = std::max( grain, ( count + workers * 4 - 1 ) / ( workers * 4 ) );
+        chunk = ( chunk + CHUNK_UNIT - 1 ) / CHUNK_UNIT * CHUNK_UNIT;
+
+        jobs->Wait( jobs->ParallelFor( count, chunk, [&](size_t begin, size_t end) {
+            VisitSparse( fn, *lead, begin, end, sequence );
+        }));
+    }
+
+    // Visits dense indices [begin, end) of the lead pool
+    // Grouped slots share the lead's dense index, only the rest are looked up
+    template<typename Fn, size_t... I>
+    void VisitSparse(Fn& fn, const SparseSet& lead, size_t begin, size_t end, std::index_sequence<I...>) {
+        for(size_t i = begin; i < end; ++i) {
+            const Entity entity = lead[i];
+
+            std::array<uint32_t, sizeof...(Ts)> index{};
+            if( !( ... && ( ( index[I] = grouped[I] ? static_cast<uint32_t>( i ) : std::get<I>(pools)->Entities().Find( entity ) ) != SparseSet::INVALID_INDEX ) ) ) {
+                continue;
+            }
+            if( !( ... && Passes<I>( std::get<I>(pools)->Ticks(), index[I] ) ) ) {
+                continue;
+            }
+
+            ( Stamp<I>( std::get<I>(pools)->Ticks(), index[I] ), ... );
+            Invoke( fn, entity, Ref<I>( std::get<I>(pools)->Components(), index[I] )... );
+        }
+    }
+
+    template<typename Fn, size_t... I>
+    void EachChunked(Fn& fn, std::index_sequence<I...> sequence) {
+        archetypes->ForEachChunk( Required( sequence ), [&](Archetype& archetype, ArchetypeChunk& chunk) {
+            VisitChunk( fn, archetype, chunk, sequence );
+        });
+    }
+
+    // One job per archetype chunk, columns are already cache line aligned
+    template<typename Fn, size_t... I>
+    void ParallelChunked(Fn& fn, std::index_sequence<I...> sequence) {
+        std::vector<std::pair<Archetype*, ArchetypeChunk*>> chunks;
+        archetypes->ForEachChunk( Required( sequence ), [&](Archetype& archetype, ArchetypeChunk& chunk) {
+            chunks.emplace_back( &archetype, &chunk );
+        });
+
+        jobs->Wait( jobs->ParallelFor( chunks.size(), 1, [&](size_t begin, size_t end) {
+            for(size_t c = begin; c < end; ++c) {
+                VisitChunk( fn, *chunks[c].first, *chunks[c].second, sequence );
+            }
+        }));
+    }
+
+    template<size_t... I>
+    Signature Required(std::index_sequence<I...>) const {
+        Signature required;
+        ( required.set( types[I] ), ... );
+        return required;
+    }
+
+    // Start of view slot I's column in a chunk, the shared instance for tags
+    template<size_t I>
+    std::remove_const_t<TypeAt<I>>* Column(Archetype& archetype, ArchetypeChunk& chunk) const {
+        using Component = std::remove_const_t<TypeAt<I>>;
+        if constexpr ( IS_TAG<I> ) {
+            return &TagInstance<Component>();
+        }
+        else {
+            return archetype.template Components<Component>( chunk, types[I] );
+        }
+    }
+
+    template<typename Fn, size_t... I>
+    void VisitChunk(Fn& fn, Archetype& archetype, ArchetypeChunk& chunk, std::index_sequence<I...>) {
+        const Entity* entities = archetype.Entities( chunk );
+        auto columns = std::make_tuple( Column<I>( archetype, chunk )... );
+        const std::array<ComponentTicks*, sizeof...(Ts)> ticks{ ( IS_TAG<I> ? nullptr : archetype.Ticks( chunk, archetype.Column( types[I] ) ) )... };
+
+        for(uint32_t row = 0; row < chunk.count; ++row) {
+            if( !( ... && Passes<I>( ticks[I], row ) ) ) {
+                continue;
+            }
+
+            ( Stamp<I>( ticks[I], row ), ... );
+            Invoke( fn, entities[row], Ref<I>( std::get<I>(columns), row )... );
+        }
+    }
+
+    StorageBackend backend;
+    ArchetypeManager* archetypes = nullptr;
+    JobSystem* jobs = nullptr;
+
+    // Change detection
+    Tick now = 0;
+    Tick since = 0;
+    std::array<uint8_t, sizeof...(Ts)> filters{};
+
+    // Component type of each of Ts...
+    std::array<ComponentType, sizeof...(Ts)> types;
+
+    // Sparse set backend pools, one per Ts...
+    std::tuple<Pool<Ts>*...> pools{};
+
+    // Owning group covering part of the view, and which slots it owns
+    const Group* group = nullptr;
+    std::array<bool, sizeof...(Ts)> grouped{};
+};
+
+#endif //VIEW_HPP
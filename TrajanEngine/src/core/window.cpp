@@ -12,17 +12,27 @@
 
 #include "window.hpp"
 
+#include <mutex>
+
 #include "log.hpp"
 
+namespace {
+    // GLFW is process-wide: initialized with the first window and terminated with the last one
+    std::mutex sGLFWMutex;
+    uint32_t sGLFWUsers = 0;
+}
+
 Window::Window(uint32_t width, uint32_t height, const std::string &name, RenderAPI api)
     : mWidth(width), mHeight(height), mName(name), mWindow(nullptr)
 {
-    static bool sGLFWInitialized = false;
-    if(!sGLFWInitialized) {
-        if(!glfwInit()) {
+    {
+        std::lock_guard<std::mutex> lock(sGLFWMutex);
+        if(sGLFWUsers == 0 && !glfwInit()) {
             Log::Assert(false, "GLFW initialization failed!");
+            return;
         }
-        sGLFWInitialized = true;
+        ++sGLFWUsers;
+        mHoldsGLFW = true;
     }
 
     if( api == RenderAPI::Vulkan ) {
@@ -56,8 +66,12 @@ Window::~Window() {
         glfwDestroyWindow(mWindow);
     }
 
-    // TODO: add static ref count and only terminate on last window being destroyed
-    glfwTerminate();
+    if( !mHoldsGLFW ) return;
+
+    std::lock_guard<std::mutex> lock(sGLFWMutex);
+    if(--sGLFWUsers == 0) {
+        glfwTerminate();
+    }
 }
 
 void Window::PollEvents() {
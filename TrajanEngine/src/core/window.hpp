@@ -50,6 +50,9 @@ private:
     uint32_t mWidth, mHeight;
     std::string mName;
     GLFWwindow* mWindow;
+
+    // This window counts towards the GLFW init/terminate refcount
+    bool mHoldsGLFW = false;
 };
 
 
@@ -13,12 +13,15 @@
 #include "opengl_renderer.hpp"
 #include <GLFW/glfw3.h>
 
+#include <chrono>
+
 #include <imgui.h>
 #include <imgui_impl_glfw.h>
 #include <imgui_impl_opengl3.h>
 
 #include "log.hpp"
 #include "texture.hpp"
+#include "trace.hpp"
 
 // Imgui Requirement
 static const char* IMGUI_GL_VERSION = "#version 460";
@@ -127,6 +130,9 @@ void OpenGLRenderer::Initialize(const RendererInitInfo &initInfo) {
     glBufferData(GL_UNIFORM_BUFFER, camSize, nullptr, GL_STATIC_DRAW);
     glBindBufferBase(GL_UNIFORM_BUFFER, CAMERA_BINDING, cameraUBO);
     glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Ring of GPU timer queries for the frame statistics
+    glGenQueries(TIMER_QUERY_COUNT, timerQueries);
 }
 
 void OpenGLRenderer::Resize(uint32_t width, uint32_t height) {
@@ -169,7 +175,40 @@ void OpenGLRenderer::SubmitRenderCommand(const RenderCommand &cmd) {
     commandQueue.push_back(cmd);
 }
 
+/*
+ *  Function: EndFrame
+ *
+ *  Description:
+ *      Executes the queued commands and imgui, then presents. The GPU time of the commands is
+ *      measured with a timer query and read back TIMER_QUERY_COUNT frames later, when it is
+ *      ready, so the reported GPU time lags the frame it belongs to.
+ *
+ *  In:
+ *      none
+ *
+ *  Out:
+ *      none
+ */
 void OpenGLRenderer::EndFrame() {
+    TRAJAN_TRACE_ZONE( "OpenGLRenderer::EndFrame" );
+    using Clock = std::chrono::steady_clock;
+
+    // The oldest query comes around again, collect it if the GPU is done with it
+    const GLuint query = timerQueries[timerIndex];
+    if( timerPending[timerIndex] ) {
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if( available ) {
+            GLuint64 elapsed = 0;
+            glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+            frameTimings.gpuMs = static_cast<float>( elapsed ) * 1.0e-6f;
+        }
+        timerPending[timerIndex] = false;
+    }
+
+    const auto submitStart = Clock::now();
+    glBeginQuery(GL_TIME_ELAPSED, query);
+
     for(const auto& cmd : commandQueue) {
         ExecuteCommand(cmd);
     }
@@ -178,8 +217,16 @@ void OpenGLRenderer::EndFrame() {
     ImGui::Render();
     ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
+    glEndQuery(GL_TIME_ELAPSED);
+    timerPending[timerIndex] = true;
+    timerIndex = ( timerIndex + 1 ) % TIMER_QUERY_COUNT;
 
+    const auto swapStart = Clock::now();
     glfwSwapBuffers(static_cast<GLFWwindow *>(window));
+    const auto swapEnd = Clock::now();
+
+    frameTimings.submitMs = std::chrono::duration<float, std::milli>( swapStart - submitStart ).count();
+    frameTimings.swapMs = std::chrono::duration<float, std::milli>( swapEnd - swapStart ).count();
 }
 
 void OpenGLRenderer::ExecuteCommand(const RenderCommand &cmd) {
@@ -310,6 +357,8 @@ static bool CheckProgram(GLuint p) {
 }
 
 uint64_t OpenGLRenderer::CreateShader(const ShaderDescriptor &desc) {
+    TRAJAN_TRACE_ZONE( "OpenGLRenderer::CreateShader" );
+
     GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
     const char* vs = desc.vertexSource.c_str();
     glShaderSource(vertex, 1, &vs, nullptr);
@@ -550,6 +599,8 @@ void OpenGLRenderer::Cleanup() {
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
 
+    glDeleteQueries(TIMER_QUERY_COUNT, timerQueries);
+
     // TODO: need to destroy openGL resources that are still alive (or do I???)
 }
 
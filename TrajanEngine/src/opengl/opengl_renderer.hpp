@@ -32,6 +32,8 @@ public:
     void SubmitRenderCommand(const RenderCommand &cmd) override;
     void EndFrame() override;
 
+    RendererFrameTimings GetFrameTimings() const override { return frameTimings; }
+
     // imgui
     ImGuiContext *GetImGuiContext() const override;
 
@@ -86,6 +88,14 @@ private:
 
     uint64_t nextHandle = 1;
 
+    // GPU timer queries, one per frame in flight so reading a result never stalls on the GPU
+    static constexpr uint32_t TIMER_QUERY_COUNT = 4;
+    GLuint timerQueries[TIMER_QUERY_COUNT] = {};
+    bool timerPending[TIMER_QUERY_COUNT] = {};
+    uint32_t timerIndex = 0;
+
+    RendererFrameTimings frameTimings;
+
     // ------------ Utility ------------
     uint64_t GenerateHandle();
     void ExecuteCommand(const RenderCommand& cmd);
@@ -1,8 +1,13 @@
 set(ENGINE_SOURCES
         ${ENGINE_SOURCES}
         # CORE
+        src/core/component.cpp
         src/core/engine.cpp
+        src/core/event_bus.cpp
+        src/core/frame_stats.cpp
+        src/core/trace.cpp
         src/core/logger.cpp
+        src/core/snapshot.cpp
         src/core/window.cpp
 
         # OPENGL RENDERER
@@ -11,14 +16,24 @@ set(ENGINE_SOURCES
         # SYSTEMS
         src/systems/render_system.cpp
         src/systems/render_system.hpp
+        src/systems/transform_system.cpp
+        src/systems/transform_system.hpp
 
         # CORE
+        src/core/archetype.hpp
+        src/core/archetype_manager.hpp
+        src/core/change_tick.hpp
+        src/core/command_buffer.hpp
         src/core/component.hpp
         src/core/component_array.hpp
         src/core/component_manager.hpp
         src/core/engine.hpp
         src/core/entity.hpp
         src/core/entity_manager.hpp
+        src/core/event_bus.hpp
+        src/core/frame_stats.hpp
+        src/core/trace.hpp
+        src/core/group.hpp
         src/core/i_logger.hpp
         src/core/asset_handle.hpp
         src/core/i_renderer.hpp
@@ -30,17 +45,26 @@ set(ENGINE_SOURCES
         src/core/shader.hpp
         src/core/system.hpp
         src/core/system_manager.hpp
+        src/core/system_profiler.hpp
         src/core/texture.hpp
         src/core/window.hpp
         src/core/uuid.hpp
+        src/core/view.hpp
         src/core/i_asset_manager.hpp
         src/core/asset_system.hpp
         src/core/mesh_manager.hpp
         src/core/shader_manager.hpp
+        src/core/signature.hpp
+        src/core/snapshot.hpp
+        src/core/snapshot_assets.hpp
+        src/core/sparse_set.hpp
+        src/core/job_system.hpp
 
         # COMPONENTS
+        src/components/hierarchy.hpp
         src/components/sprite.hpp
         src/components/transform_2d.hpp
+        src/components/world_transform.hpp
 
         # OPENGL RENDERER
         src/opengl/opengl_renderer.hpp
@@ -12,11 +12,14 @@
 
 #include "render_system.hpp"
 
+#include <cmath>
+#include <numbers>
+
 #include "engine.hpp"
 #include "i_renderer.hpp"
 #include "orchestrator.hpp"
 #include "sprite.hpp"
-#include "transform_2d.hpp"
+#include "world_transform.hpp"
 
 void RenderSystem::Initialize(const SystemContext& ctx) {
     mOrchestrator = &ctx.orchestrator;
@@ -24,17 +27,114 @@ void RenderSystem::Initialize(const SystemContext& ctx) {
 }
 
 void RenderSystem::Update(float dt) {
-    for(const auto& entity : entities) {
-        const auto& transform = mOrchestrator->GetComponent<Transform2D>(entity);
-        const auto& sprite = mOrchestrator->GetComponent<Sprite>(entity);
+    if( mPoseVersion != membershipVersion ) {
+        RemapPoses();
+    }
+
+    // World matrices are kept up to date by TransformSystem
+    mOrchestrator->View<const WorldTransform, const Sprite>().Each([&](Entity entity, const WorldTransform& world, const Sprite&) {
+        // First step seen for this member: nothing to interpolate from yet
+        Pose& pose = mPoses[entities.Index( entity )];
+        const Affine2D current = Decompose( world.matrix );
+        pose.previous = pose.entity == entity ? pose.current : current;
+        pose.current = current;
+        pose.entity = entity;
+    });
+}
+
+void RenderSystem::Render(float alpha) {
+    // Members can change between steps, e.g. through the editor
+    if( mPoseVersion != membershipVersion ) {
+        RemapPoses();
+    }
 
+    mOrchestrator->View<const WorldTransform, const Sprite>().Each([&](Entity entity, const WorldTransform& world, const Sprite& sprite) {
         // Submit renderable to renderer
         RenderCommand cmd;
         cmd.type = RenderCommand::Type::Mesh;
-        cmd.mesh = sprite.mesh.operator->();
-        cmd.shader = sprite.shader.operator->();
-        cmd.transform = transform.Matrix();
+        cmd.mesh = sprite.mesh.get();
+        cmd.shader = sprite.shader.get();
+        cmd.transform = world.matrix;
+
+        // Entities added since the last step have no pose yet and are drawn where they are
+        const uint32_t index = entities.Index( entity );
+        if( mPoses[index].entity == entity ) {
+            const Pose& pose = mPoses[index];
+            Compose( Interpolate( pose.previous, pose.current, alpha ), cmd.transform );
+        }
 
         mRenderer->SubmitRenderCommand(cmd);
+    });
+}
+
+/*
+ *  Function: RemapPoses
+ *
+ *  Description:
+ *      Rebuilds the poses so they line up with entities again. Members that kept their pose
+ *      are moved to their new dense index, new members get an empty slot and poses of
+ *      removed members are dropped, so the buffer never outgrows the membership.
+ *
+ *  In:
+ *      none
+ *
+ *  Out:
+ *      none
+ */
+void RenderSystem::RemapPoses() {
+    mRemapped.assign( entities.Size(), Pose{} );
+    for(const Pose& pose : mPoses) {
+        const uint32_t index = entities.Find( pose.entity );
+        if( index != SparseSet::INVALID_INDEX ) {
+            mRemapped[index] = pose;
+        }
     }
+
+    mPoses.swap( mRemapped );
+    mRemapped.clear();
+    mPoseVersion = membershipVersion;
+}
+
+RenderSystem::Affine2D RenderSystem::Decompose(const Matrix4& matrix) {
+    const Vector2 x( matrix[0] );
+    const Vector2 y( matrix[1] );
+
+    Affine2D affine;
+    affine.position = Vector2( matrix[3] );
+    affine.angle = std::atan2( x.y, x.x );
+    affine.scale.x = glm::length( x );
+
+    // Y axis in the frame rotated by angle: its x is the shear, its y the (signed) scale
+    const float c = std::cos( affine.angle );
+    const float s = std::sin( affine.angle );
+    affine.shear = c * y.x + s * y.y;
+    affine.scale.y = c * y.y - s * y.x;
+    return affine;
+}
+
+// Linear in position, scale and shear, the angle turns the short way round
+RenderSystem::Affine2D RenderSystem::Interpolate(const Affine2D& from, const Affine2D& to, float alpha) {
+    constexpr float PI = std::numbers::pi_v<float>;
+
+    float turn = std::remainder( to.angle - from.angle, 2.0f * PI );
+    if( turn == -PI ) turn = PI;
+
+    Affine2D affine;
+    affine.position = glm::mix( from.position, to.position, alpha );
+    affine.angle = from.angle + turn * alpha;
+    affine.scale = glm::mix( from.scale, to.scale, alpha );
+    affine.shear = glm::mix( from.shear, to.shear, alpha );
+    return affine;
+}
+
+void RenderSystem::Compose(const Affine2D& affine, Matrix4& matrix) {
+    const float c = std::cos( affine.angle );
+    const float s = std::sin( affine.angle );
+
+    matrix[0].x = c * affine.scale.x;
+    matrix[0].y = s * affine.scale.x;
+    matrix[1].x = c * affine.shear - s * affine.scale.y;
+    matrix[1].y = s * affine.shear + c * affine.scale.y;
+    matrix[3].x = affine.position.x;
+    matrix[3].y = affine.position.y;
 }
@@ -12,6 +12,9 @@
 
 #ifndef RENDER_SYSTEM_HPP
 #define RENDER_SYSTEM_HPP
+#include <vector>
+
+#include "math.hpp"
 #include "system.hpp"
 
 class Orchestrator;
@@ -21,13 +24,47 @@ class RenderSystem : public System {
 public:
     void Initialize(const SystemContext& ctx) override;
 
+    // Simulation step: records where every sprite is, nothing is drawn here
     void Update(float dt) override;
 
+    // Displayed frame: submits every sprite between its last two simulation poses
+    void Render(float alpha) override;
+
     void Shutdown() override {};
 
 private:
+    // Moves the poses to the members' new dense indices after entities gained or lost members
+    void RemapPoses();
+
+    // 2D part of a world matrix split into parts that can be interpolated
+    // The linear part is rotation(angle) * [scale.x shear; 0 scale.y], which any 2D affine matrix decomposes into
+    struct Affine2D {
+        Vector2 position{0.0f};
+        float angle = 0.0f;
+        Vector2 scale{1.0f};
+        float shear = 0.0f;
+    };
+
+    // World transform of an entity at the last two simulation steps
+    struct Pose {
+        Entity entity = NULL_ENTITY;
+        Affine2D previous;
+        Affine2D current;
+    };
+
+    static Affine2D Decompose(const Matrix4& matrix);
+    static Affine2D Interpolate(const Affine2D& from, const Affine2D& to, float alpha);
+
+    // Writes the 2D part back into matrix, leaving its depth untouched
+    static void Compose(const Affine2D& affine, Matrix4& matrix);
+
     IRenderer* mRenderer = nullptr;
     Orchestrator* mOrchestrator = nullptr;
+
+    // Parallel to entities, entity tells whether the slot has been filled for its current member
+    std::vector<Pose> mPoses;
+    std::vector<Pose> mRemapped;
+    uint32_t mPoseVersion = 0;
 };
 
 #endif //RENDER_SYSTEM_HPP
@@ -0,0 +1,203 @@
+/*
+* File: transform_system.cpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#include "transform_system.hpp"
+
+#include <algorithm>
+
+#include "hierarchy.hpp"
+#include "log.hpp"
+#include "orchestrator.hpp"
+#include "transform_2d.hpp"
+#include "world_transform.hpp"
+
+void TransformSystem::Initialize(const SystemContext& ctx) {
+    mOrchestrator = &ctx.orchestrator;
+}
+
+void TransformSystem::Update(float dt) {
+    AttachWorldTransforms();
+
+    const bool rebuilt = StructureChanged();
+    if( rebuilt ) {
+        Rebuild();
+    }
+
+    // Local matrices of every node after a rebuild, otherwise only of transforms that moved
+    auto local = [&](Entity entity, const Transform2D& transform, const WorldTransform&) {
+        const uint32_t slot = mSlots[EntityIndex( entity )];
+        mLocals[slot] = transform.Matrix();
+        mDirty[slot] = 1;
+    };
+    if( rebuilt ) {
+        mOrchestrator->View<const Transform2D, const WorldTransform>().Each( local );
+    }
+    else {
+        mOrchestrator->View<const Transform2D, const WorldTransform>().Changed<Transform2D>().Each( local );
+    }
+
+    // Grouped pools are in node order, slot i is written straight to dense index i
+    WorldTransform* worlds = nullptr;
+    ComponentTicks* ticks = nullptr;
+    if( mLinear ) {
+        ComponentArray<WorldTransform>* pool = mOrchestrator->GetComponentArray<WorldTransform>();
+        worlds = pool->Components();
+        ticks = pool->Ticks();
+    }
+    const Tick now = mOrchestrator->GetTick();
+
+    // Parents precede their children, so a parent's world matrix is final before any child reads it
+    for(size_t i = 0; i < mNodes.size(); ++i) {
+        const uint32_t parent = mNodes[i].parent;
+        if( parent != NO_SLOT && mDirty[parent] ) {
+            mDirty[i] = 1;
+        }
+        if( !mDirty[i] ) continue;
+
+        mWorlds[i] = parent == NO_SLOT ? mLocals[i] : mWorlds[parent] * mLocals[i];
+        if( mLinear ) {
+            worlds[i].matrix = mWorlds[i];
+            ticks[i].changed = now;
+        }
+        else {
+            mOrchestrator->GetComponent<WorldTransform>( mNodes[i].entity ).matrix = mWorlds[i];
+        }
+    }
+    std::fill( mDirty.begin(), mDirty.end(), 0 );
+}
+
+void TransformSystem::AttachWorldTransforms() {
+    CommandBuffer& commands = mOrchestrator->GetCommandBuffer();
+
+    mOrchestrator->View<const Transform2D>().Added<Transform2D>().Each([&](Entity entity, const Transform2D& transform) {
+        if( mOrchestrator->HasComponent<WorldTransform>( entity ) ) return;
+
+        // Placed right away for the frame it appears in, the next step links it into the hierarchy
+        Matrix4 world = transform.Matrix();
+        if( mOrchestrator->HasComponent<Hierarchy>( entity ) ) {
+            const Entity parent = mOrchestrator->GetComponent<const Hierarchy>( entity ).parent;
+            if( mOrchestrator->HasComponent<WorldTransform>( parent ) ) {
+                world = mOrchestrator->GetComponent<const WorldTransform>( parent ).matrix * world;
+            }
+        }
+        commands.AddComponent( entity, WorldTransform{ world } );
+    });
+}
+
+bool TransformSystem::StructureChanged() {
+    // Adding, editing or removing a Hierarchy does not change membership, the pool's write tick catches all three
+    const bool changed = !mBuilt || membershipVersion != mBuiltVersion || mOrchestrator->AnyChanged<Hierarchy>();
+    mBuilt = true;
+    mBuiltVersion = membershipVersion;
+    return changed;
+}
+
+/*
+ *  Function: Rebuild
+ *
+ *  Description:
+ *      Sorts every member breadth-first: roots first, then each depth in turn, with the
+ *      children of a node stored next to each other. Links to entities outside the system
+ *      make a root, parent cycles are cut with a warning.
+ *
+ *  In:
+ *      none
+ *
+ *  Out:
+ *      none
+ */
+void TransformSystem::Rebuild() {
+    uint32_t extent = 0;
+    for(Entity entity : entities) {
+        extent = std::max( extent, EntityIndex( entity ) + 1 );
+    }
+
+    mParents.assign( extent, NULL_ENTITY );
+    mSlots.assign( extent, NO_SLOT );
+
+    // Parent links that point at another member
+    mOrchestrator->View<const Hierarchy, const Transform2D, const WorldTransform>().Each(
+        [&](Entity entity, const Hierarchy& link, const Transform2D&, const WorldTransform&) {
+            if( link.parent != entity && entities.Contains( link.parent ) ) {
+                mParents[EntityIndex( entity )] = link.parent;
+            }
+        });
+
+    // Children grouped per parent (counting sort), siblings keep their member order
+    mChildStart.assign( extent + 1, 0 );
+    for(Entity entity : entities) {
+        const Entity parent = mParents[EntityIndex( entity )];
+        if( parent != NULL_ENTITY ) ++mChildStart[EntityIndex( parent ) + 1];
+    }
+    for(uint32_t i = 0; i < extent; ++i) {
+        mChildStart[i + 1] += mChildStart[i];
+    }
+
+    mChildren.resize( mChildStart[extent] );
+    mChildCursor.assign( mChildStart.begin(), mChildStart.end() - 1 );
+    for(Entity entity : entities) {
+        const Entity parent = mParents[EntityIndex( entity )];
+        if( parent != NULL_ENTITY ) mChildren[mChildCursor[EntityIndex( parent )]++] = entity;
+    }
+
+    mNodes.clear();
+    mNodes.reserve( entities.Size() );
+    auto place = [&](Entity entity, uint32_t parent) {
+        mSlots[EntityIndex( entity )] = static_cast<uint32_t>( mNodes.size() );
+        mNodes.push_back( { entity, parent } );
+    };
+
+    // Breadth-first, mNodes doubles as the queue
+    auto expand = [&](size_t from) {
+        for(size_t i = from; i < mNodes.size(); ++i) {
+            const uint32_t index = EntityIndex( mNodes[i].entity );
+            for(uint32_t c = mChildStart[index]; c < mChildStart[index + 1]; ++c) {
+                if( mSlots[EntityIndex( mChildren[c] )] == NO_SLOT ) {
+                    place( mChildren[c], static_cast<uint32_t>( i ) );
+                }
+            }
+        }
+    };
+
+    for(Entity entity : entities) {
+        if( mParents[EntityIndex( entity )] == NULL_ENTITY ) place( entity, NO_SLOT );
+    }
+    expand( 0 );
+
+    // Whatever is left hangs off a parent cycle, cut it at the first member found
+    for(Entity entity : entities) {
+        if( mSlots[EntityIndex( entity )] != NO_SLOT ) continue;
+
+        Log::Warn("Hierarchy cycle through entity " + std::to_string(entity) + ", treating it as a root");
+        const size_t from = mNodes.size();
+        place( entity, NO_SLOT );
+        expand( from );
+    }
+
+    mLocals.resize( mNodes.size() );
+    mWorlds.resize( mNodes.size() );
+    mDirty.assign( mNodes.size(), 1 );
+
+    mLinear = ArrangeGroup();
+}
+
+bool TransformSystem::ArrangeGroup() {
+    // Group members are exactly the entities owning both, i.e. this system's members
+    Group* group = mOrchestrator->GetGroup<Transform2D, WorldTransform>();
+    if( !group || group->Size() != mNodes.size() ) return false;
+
+    mOrder.resize( mNodes.size() );
+    for(size_t i = 0; i < mNodes.size(); ++i) {
+        mOrder[i] = mNodes[i].entity;
+    }
+    return group->Arrange( mOrder ) == mNodes.size();
+}
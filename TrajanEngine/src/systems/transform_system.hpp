@@ -0,0 +1,86 @@
+/*
+* File: transform_system.hpp
+* Project: Trajan
+* Author: ${AUTHOR}
+* Created on: 10/17/2026
+*
+* Copyright (c) 2025 Collin Longoria
+*
+* This software is released under the MIT License.
+* https://opensource.org/licenses/MIT
+*/
+
+#ifndef TRANSFORM_SYSTEM_HPP
+#define TRANSFORM_SYSTEM_HPP
+#include <cstdint>
+#include <vector>
+
+#include "entity.hpp"
+#include "math.hpp"
+#include "system.hpp"
+
+class Orchestrator;
+
+// Computes WorldTransform from Transform2D and the optional Hierarchy parent link
+// Entities given a Transform2D without a WorldTransform get one attached, so they need no extra setup to render.
+// Nodes are kept in breadth-first order (parents before children, siblings adjacent), so world
+// transforms are resolved in one linear pass. Only nodes whose local transform changed, and
+// their subtrees, are recomputed.
+// With an owning group over Transform2D and WorldTransform (sparse set storage) the group is kept in
+// node order too, so the pass writes WorldTransform straight into its pool without lookups.
+class TransformSystem : public System {
+public:
+    void Initialize(const SystemContext& ctx) override;
+
+    void Update(float dt) override;
+
+    void Shutdown() override {};
+
+private:
+    // Empty slot: a root's parent, or an entity without a node
+    static constexpr uint32_t NO_SLOT = UINT32_MAX;
+
+    struct Node {
+        Entity entity;
+        uint32_t parent; // Slot of the parent node, NO_SLOT for roots
+    };
+
+    // Queues a WorldTransform for every new Transform2D that lacks one
+    void AttachWorldTransforms();
+
+    // True if membership or any parent link changed since the nodes were built
+    bool StructureChanged();
+
+    // Re-sorts every member breadth-first and marks all nodes dirty
+    void Rebuild();
+
+    // Puts the Transform2D/WorldTransform group in node order, true if slot i is now dense index i of both pools
+    bool ArrangeGroup();
+
+    Orchestrator* mOrchestrator = nullptr;
+
+    // Breadth-first node order, and per-slot data index-aligned with it
+    std::vector<Node> mNodes;
+    std::vector<Matrix4> mLocals;
+    std::vector<Matrix4> mWorlds;
+    std::vector<uint8_t> mDirty;
+
+    // Slot of each member <- Index corresponds to entity index
+    std::vector<uint32_t> mSlots;
+
+    // State the nodes were built from
+    uint32_t mBuiltVersion = UINT32_MAX;
+    bool mBuilt = false;
+
+    // Group matches node order, until the next membership change
+    bool mLinear = false;
+
+    // Rebuild scratch <- Index corresponds to entity index
+    std::vector<Entity> mParents;
+    std::vector<uint32_t> mChildStart;
+    std::vector<Entity> mChildren;
+    std::vector<uint32_t> mChildCursor;
+    std::vector<Entity> mOrder;
+};
+
+#endif //TRANSFORM_SYSTEM_HPP